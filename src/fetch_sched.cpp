@@ -0,0 +1,79 @@
+#include <string.h>
+
+#include "fetch_sched.h"
+
+// =============================
+// 상태
+// =============================
+struct SchedCell {
+  uint8_t nx;      // 0이면 빈 칸
+  uint8_t ny;
+  uint32_t doneMs; // 마지막으로 다 받은 시각 (millis)
+};
+
+static SchedCell recent[FETCH_SCHED_CELLS];
+
+static volatile uint32_t currentGeneration = 0;  // fetch 작업이 다른 코어에서 읽는다
+static bool inFlight = false;
+static uint8_t inFlightNx = 0;
+static uint8_t inFlightNy = 0;
+
+static SchedCell* findCell(int nx, int ny) {
+  for (int i = 0; i < FETCH_SCHED_CELLS; i++) {
+    if (recent[i].nx == nx && recent[i].ny == ny && recent[i].nx != 0) return &recent[i];
+  }
+  return nullptr;
+}
+
+FetchDecision fetchSchedRequest(int nx, int ny, bool haveData, uint32_t nowMs, uint32_t* generation) {
+  if (inFlight && inFlightNx == nx && inFlightNy == ny) {
+    *generation = currentGeneration;
+    return FETCH_COALESCED;
+  }
+
+  SchedCell* c = findCell(nx, ny);
+  if (haveData && c != nullptr && nowMs - c->doneMs < FETCH_MIN_INTERVAL_MS) return FETCH_RECENT;
+
+  currentGeneration = currentGeneration + 1;
+  inFlight = true;
+  inFlightNx = (uint8_t)nx;
+  inFlightNy = (uint8_t)ny;
+  *generation = currentGeneration;
+  return FETCH_START;
+}
+
+void fetchSchedDone(uint32_t generation, bool complete, uint32_t nowMs) {
+  if (!inFlight || generation != currentGeneration) return;  // 이미 다른 요청으로 바뀜
+  inFlight = false;
+
+  SchedCell* c = findCell(inFlightNx, inFlightNy);
+  if (!complete) {
+    if (c != nullptr) c->nx = 0;  // 다음 요청은 다시 받는다
+    return;
+  }
+
+  if (c == nullptr) {
+    // 빈 칸, 없으면 가장 오래전에 받은 칸
+    c = &recent[0];
+    for (int i = 1; i < FETCH_SCHED_CELLS && c->nx != 0; i++) {
+      if (recent[i].nx == 0 || (int32_t)(recent[i].doneMs - c->doneMs) < 0) c = &recent[i];
+    }
+    c->nx = inFlightNx;
+    c->ny = inFlightNy;
+  }
+  c->doneMs = nowMs;
+}
+
+bool fetchSchedIsCurrent(uint32_t generation) {
+  return generation == currentGeneration;
+}
+
+bool fetchSchedBusy() {
+  return inFlight;
+}
+
+void fetchSchedClear() {
+  memset(recent, 0, sizeof(recent));
+  inFlight = false;
+  currentGeneration = currentGeneration + 1;  // 진행 중이던 요청도 취소
+}
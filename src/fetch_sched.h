@@ -0,0 +1,42 @@
+#ifndef FETCH_SCHED_H
+#define FETCH_SCHED_H
+
+#include <stdint.h>
+
+// =============================
+// 날씨 가져오기 스케줄러
+// =============================
+// 버튼, 시리얼 좌표, 시리얼 지역명 입력이 연달아 들어와도 요청 수가 누른 횟수가 아니라
+// 서로 다른 격자 수를 따라가게 한다.
+//  - 같은 격자를 받는 중이면 새로 시작하지 않고 합친다.
+//  - 다른 격자 요청이 오면 세대 번호를 올린다. 받는 쪽(fetch 작업)은 시간마다
+//    fetchSchedIsCurrent로 확인해서 지난 세대면 그만둔다.
+//  - 같은 격자를 FETCH_MIN_INTERVAL_MS 안에 다 받았고 그 값을 아직 들고 있으면 다시 받지 않는다.
+// 상태 변경은 loop()에서만 하고, fetch 작업(core 0)은 fetchSchedIsCurrent만 부른다.
+
+#define FETCH_SCHED_CELLS 8                        // 최근에 다 받은 격자 기록 수
+#define FETCH_MIN_INTERVAL_MS (5UL * 60UL * 1000UL)  // 같은 격자 다시 받기까지 최소 간격
+
+enum FetchDecision : uint8_t {
+  FETCH_START,      // 새 세대로 시작 (진행 중이던 다른 격자는 취소)
+  FETCH_COALESCED,  // 같은 격자를 이미 받는 중
+  FETCH_RECENT      // 최근에 다 받음, 받지 않음
+};
+
+// haveData: 호출한 쪽이 이 격자의 값을 지금 들고 있는지 (화면의 격자와 같은지)
+// FETCH_START, FETCH_COALESCED면 *generation에 그 요청의 세대 번호
+FetchDecision fetchSchedRequest(int nx, int ny, bool haveData, uint32_t nowMs, uint32_t* generation);
+
+// 세대 generation의 요청이 끝남. complete: 모든 시간을 받았을 때만 true (실패가 있으면 다음에 다시 받음)
+void fetchSchedDone(uint32_t generation, bool complete, uint32_t nowMs);
+
+// generation이 아직 최신 요청인지 (fetch 작업에서 호출)
+bool fetchSchedIsCurrent(uint32_t generation);
+
+// 진행 중인 요청이 있는지
+bool fetchSchedBusy();
+
+// 기록 비우기
+void fetchSchedClear();
+
+#endif // FETCH_SCHED_H
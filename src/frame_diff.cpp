@@ -0,0 +1,23 @@
+#include <string.h>
+
+#include "frame_diff.h"
+
+int frameDiff(const uint8_t* now, const uint8_t* shown, int width, int pages, FrameSpan spans[]) {
+  int count = 0;
+  for (int p = 0; p < pages; p++) {
+    const uint8_t* a = now + p * width;
+    const uint8_t* b = shown + p * width;
+    if (memcmp(a, b, width) == 0) continue;
+
+    int first = 0;
+    while (a[first] == b[first]) first++;
+    int last = width - 1;
+    while (a[last] == b[last]) last--;
+
+    spans[count].page = (uint8_t)p;
+    spans[count].first = (uint8_t)first;
+    spans[count].last = (uint8_t)last;
+    count++;
+  }
+  return count;
+}
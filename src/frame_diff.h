@@ -0,0 +1,21 @@
+#ifndef FRAME_DIFF_H
+#define FRAME_DIFF_H
+
+#include <stdint.h>
+
+// =============================
+// 프레임 버퍼 비교 (SSD1306 부분 전송용)
+// =============================
+// SSD1306 버퍼는 페이지(세로 8픽셀) x 열 바이트 순서다. 새로 그린 버퍼를 패널에 보낸 것과
+// 비교해서 페이지마다 바뀐 열 범위만 찾는다. 1 KB 비교는 수 µs, I2C 1 KB 전송은 약 25 ms.
+
+struct FrameSpan {
+  uint8_t page;
+  uint8_t first;  // 바뀐 첫 열
+  uint8_t last;   // 바뀐 마지막 열
+};
+
+// spans[0 .. pages-1]에 바뀐 페이지만 순서대로 채우고 그 수를 돌려준다.
+int frameDiff(const uint8_t* now, const uint8_t* shown, int width, int pages, FrameSpan spans[]);
+
+#endif // FRAME_DIFF_H
@@ -0,0 +1,129 @@
+#include <math.h>
+
+#include "grid.h"
+
+// =============================
+// Lambert 정각원추 투영 상수 (한 번만 계산)
+// =============================
+// sn / sf / ro 는 SLAT1, SLAT2, OLAT 매크로에만 의존하므로
+// 프로그램 시작 때 한 번 계산해 두고, 매 호출은 점마다 필요한 계산만 한다.
+struct LccProjection {
+    double re;    // 격자 단위 지구 반경
+    double olon;  // 기준 경도(rad)
+    double sn;
+    double sf;
+    double ro;
+};
+
+static LccProjection makeProjection() {
+    LccProjection p;
+    double slat1 = SLAT1 * DEGRAD;
+    double slat2 = SLAT2 * DEGRAD;
+    double olat = OLAT * DEGRAD;
+
+    p.re = RE / GRID;
+    p.olon = OLON * DEGRAD;
+
+    p.sn = tan(M_PI * 0.25 + slat2 * 0.5) / tan(M_PI * 0.25 + slat1 * 0.5);
+    p.sn = log(cos(slat1) / cos(slat2)) / log(p.sn);
+
+    p.sf = tan(M_PI * 0.25 + slat1 * 0.5);
+    p.sf = pow(p.sf, p.sn) * cos(slat1) / p.sn;
+
+    p.ro = tan(M_PI * 0.25 + olat * 0.5);
+    p.ro = p.re * p.sf / pow(p.ro, p.sn);
+    return p;
+}
+
+static const LccProjection lcc = makeProjection();
+
+// 한 점 변환 (상수는 호출한 쪽에서 한 번 읽어 넘긴다)
+static inline GridPoint projectPoint(const LccProjection& p, double lat, double lon) {
+    GridPoint point;
+
+    double ra = tan(M_PI * 0.25 + lat * DEGRAD * 0.5);
+    ra = p.re * p.sf / pow(ra, p.sn);
+
+    double theta = lon * DEGRAD - p.olon;
+    if (theta > M_PI) theta -= 2.0 * M_PI;
+    if (theta < -M_PI) theta += 2.0 * M_PI;
+    theta *= p.sn;
+
+    point.x = (int)floor(ra * sin(theta) + XO + 0.5);
+    point.y = (int)floor(p.ro - ra * cos(theta) + YO + 0.5);
+
+    return point;
+}
+
+// =============================
+// 단정밀도 변환 (ESP32 FPU는 float만 하드웨어로 계산)
+// =============================
+// 격자 번호(5km)만 필요하므로 float로 충분하다. 경도차는 도 단위에서 먼저 빼서
+// 큰 값끼리의 뺄셈 오차를 줄인다. 표의 모든 행에서 double 결과와 같은 격자가 나오는지
+// test_bench에서 확인한다.
+struct LccProjectionF {
+    float k;     // re * sf
+    float sn;
+    float ro;
+};
+
+static const LccProjectionF lccF = { (float)(lcc.re * lcc.sf), (float)lcc.sn, (float)lcc.ro };
+
+GridPoint changeToXYFloat(float lat, float lon) {
+    GridPoint point;
+    const float degrad = (float)DEGRAD;
+
+    float ra = tanf((float)(M_PI * 0.25) + lat * degrad * 0.5f);
+    ra = lccF.k / powf(ra, lccF.sn);
+
+    float theta = (lon - (float)OLON) * degrad;
+    if (theta > (float)M_PI) theta -= (float)(2.0 * M_PI);
+    if (theta < (float)-M_PI) theta += (float)(2.0 * M_PI);
+    theta *= lccF.sn;
+
+    point.x = (int)floorf(ra * sinf(theta) + XO + 0.5f);
+    point.y = (int)floorf(lccF.ro - ra * cosf(theta) + YO + 0.5f);
+
+    return point;
+}
+
+// 위도, 경도를 입력받아 격자 X, Y를 반환하는 함수
+GridPoint changeToXY(double lat, double lon) {
+#ifdef GRID_PROJECTION_FLOAT
+    return changeToXYFloat((float)lat, (float)lon);
+#else
+    return projectPoint(lcc, lat, lon);
+#endif
+}
+
+// 위도, 경도 배열 n개를 한 번에 격자로 변환 (out[i] = changeToXY(lat[i], lon[i]))
+// changeToXY와 같은 커널을 써야 격자 경계의 점도 같은 격자가 나온다.
+void changeToXYBatch(const double* lat, const double* lon, GridPoint* out, size_t n) {
+#ifdef GRID_PROJECTION_FLOAT
+    for (size_t i = 0; i < n; i++) {
+        out[i] = changeToXYFloat((float)lat[i], (float)lon[i]);
+    }
+#else
+    const LccProjection p = lcc;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = projectPoint(p, lat[i], lon[i]);
+    }
+#endif
+}
+
+// 격자 X, Y 중심의 위도, 경도를 구하는 함수 (changeToXY의 역변환)
+void changeToLatLon(int x, int y, double* lat, double* lon) {
+    double xn = x - XO;
+    double yn = lcc.ro - y + YO;
+    double ra = sqrt(xn * xn + yn * yn);
+    if (lcc.sn < 0.0) ra = -ra;
+
+    double alat = pow(lcc.re * lcc.sf / ra, 1.0 / lcc.sn);
+    alat = 2.0 * atan(alat) - M_PI * 0.5;
+
+    double theta = atan2(xn, yn);
+    double alon = theta / lcc.sn + lcc.olon;
+
+    *lat = alat / DEGRAD;
+    *lon = alon / DEGRAD;
+}
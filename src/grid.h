@@ -0,0 +1,42 @@
+#ifndef GRID_H
+#define GRID_H
+
+// =============================
+// 기상청 격자 변환 상수 및 정의
+// =============================
+#include <stddef.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define RE 6371.00877 // 지구 반경(km)
+#define GRID 5.0      // 격자 간격(km)
+#define SLAT1 30.0    // 투영 위도1(degree)
+#define SLAT2 60.0    // 투영 위도2(degree)
+#define OLON 126.0    // 기준점 경도(degree)
+#define OLAT 38.0     // 기준점 위도(degree)
+#define XO 43         // 기준점 X좌표(GRID)
+#define YO 136        // 기준점 Y좌표(GRID)
+#define DEGRAD (M_PI / 180.0)
+
+// X, Y 좌표를 담을 구조체 정의
+typedef struct {
+    int x;
+    int y;
+} GridPoint;
+
+// 위도, 경도를 입력받아 격자 X, Y를 반환하는 함수
+GridPoint changeToXY(double lat, double lon);
+
+// 단정밀도 변환 (GRID_PROJECTION_FLOAT 빌드에서는 changeToXY가 이것을 쓴다)
+GridPoint changeToXYFloat(float lat, float lon);
+
+// 위도, 경도 배열 n개를 한 번에 격자로 변환 (out[i] = changeToXY(lat[i], lon[i]))
+// GRID_PROJECTION_FLOAT 빌드에서는 changeToXY처럼 단정밀도 변환을 쓴다.
+void changeToXYBatch(const double* lat, const double* lon, GridPoint* out, size_t n);
+
+// 격자 X, Y 중심의 위도, 경도를 구하는 함수 (changeToXY의 역변환)
+void changeToLatLon(int x, int y, double* lat, double* lon);
+
+#endif // GRID_H
@@ -0,0 +1,348 @@
+#include <Arduino.h>
+#include <string.h>
+#ifdef OBS_CACHE_LITTLEFS
+#include <LittleFS.h>
+#endif
+
+#include "history_log.h"
+
+#define HISTORY_LOG_TAG 0xB7   // 블록 첫 바이트, 형식이 바뀌면 바꿀 것
+
+// =============================
+// 비트 쓰기
+// =============================
+namespace {
+
+struct BitWriter {
+  uint8_t* out;
+  size_t cap;
+  size_t pos;      // 바이트 위치
+  uint8_t used;    // out[pos]에 쓴 비트 수
+  bool overflow;
+
+  void put(uint32_t v, uint8_t n) {
+    while (n > 0) {
+      if (pos >= cap) { overflow = true; return; }
+      if (used == 0) out[pos] = 0;
+      uint8_t room = 8 - used;
+      uint8_t take = n < room ? n : room;
+      uint8_t bits = (uint8_t)((v >> (n - take)) & ((1u << take) - 1));
+      out[pos] |= (uint8_t)(bits << (room - take));
+      used += take;
+      n -= take;
+      if (used == 8) { pos++; used = 0; }
+    }
+  }
+
+  size_t bytes() const { return pos + (used ? 1 : 0); }
+};
+
+// 시각 간격의 변화량: 0 -> '0', -64..63 -> '10' + 7비트, 나머지 -> '11' + 32비트
+void putDod(BitWriter& w, int32_t dod) {
+  if (dod == 0) { w.put(0, 1); return; }
+  if (dod >= -64 && dod <= 63) { w.put(0x2, 2); w.put((uint32_t)dod, 7); return; }
+  w.put(0x3, 2);
+  w.put((uint32_t)dod, 32);
+}
+
+// 값의 차이: 0 -> '0', -32..31 -> '10' + 6비트, -2048..2047 -> '110' + 12비트, 나머지 -> '111' + 17비트
+void putField(BitWriter& w, int32_t prev, int32_t v) {
+  int32_t d = v - prev;
+  if (d == 0) { w.put(0, 1); return; }
+  if (d >= -32 && d <= 31) { w.put(0x2, 2); w.put((uint32_t)d, 6); return; }
+  if (d >= -2048 && d <= 2047) { w.put(0x6, 3); w.put((uint32_t)d, 12); return; }
+  w.put(0x7, 3);
+  w.put((uint32_t)d, 17);
+}
+
+} // namespace
+
+size_t historyLogEncode(uint8_t nx, uint8_t ny, const int32_t hours[], const PackedObs samples[],
+                        int count, uint8_t* out, size_t cap) {
+  if (count <= 0 || count > HISTORY_LOG_BATCH || cap < 6) return 0;
+
+  BitWriter w = { out + 6, cap - 6, 0, 0, false };
+  const PackedObs& first = samples[0];
+  w.put((uint32_t)hours[0], 32);
+  w.put((uint16_t)first.t10, 16);
+  w.put(first.rn10, 16);
+  w.put(first.reh, 8);
+  w.put(first.wsd10, 8);
+  w.put(first.vec2, 8);
+
+  int32_t delta = 1;  // 매시간이면 첫 간격도 '0' 한 비트
+  for (int i = 1; i < count; i++) {
+    int32_t d = hours[i] - hours[i - 1];
+    putDod(w, d - delta);
+    delta = d;
+
+    const PackedObs& p = samples[i - 1];
+    const PackedObs& s = samples[i];
+    putField(w, p.t10, s.t10);
+    putField(w, p.rn10, s.rn10);
+    putField(w, p.reh, s.reh);
+    putField(w, p.wsd10, s.wsd10);
+    putField(w, p.vec2, s.vec2);
+  }
+  if (w.overflow) return 0;
+
+  size_t len = w.bytes();
+  out[0] = HISTORY_LOG_TAG;
+  out[1] = nx;
+  out[2] = ny;
+  out[3] = (uint8_t)count;
+  out[4] = (uint8_t)(len & 0xFF);
+  out[5] = (uint8_t)(len >> 8);
+  return 6 + len;
+}
+
+// =============================
+// 읽기
+// =============================
+HistoryLogReader::HistoryLogReader(Stream& in, uint8_t nx, uint8_t ny)
+    : in_(in), nx_(nx), ny_(ny), left_(0), index_(0), bytes_(0), byte_(0), bitsLeft_(0),
+      hour_(0), delta_(1), prev_(), end_(false) {}
+
+bool HistoryLogReader::skip(uint16_t n) {
+  while (n--) {
+    if (in_.read() < 0) return false;
+  }
+  return true;
+}
+
+// 다음 (nx, ny) 블록의 헤더까지 읽는다.
+bool HistoryLogReader::beginBlock() {
+  for (;;) {
+    uint8_t h[6];
+    for (int i = 0; i < 6; i++) {
+      int c = in_.read();
+      if (c < 0) return false;
+      h[i] = (uint8_t)c;
+    }
+    uint16_t len = (uint16_t)(h[4] | (h[5] << 8));
+    if (h[0] != HISTORY_LOG_TAG || h[3] == 0 || h[3] > HISTORY_LOG_BATCH) return false;
+
+    if (h[1] == nx_ && h[2] == ny_) {
+      left_ = h[3];
+      index_ = 0;
+      bytes_ = len;
+      bitsLeft_ = 0;
+      delta_ = 1;
+      return true;
+    }
+    if (!skip(len)) return false;
+  }
+}
+
+bool HistoryLogReader::readBits(uint8_t n, uint32_t& v) {
+  v = 0;
+  while (n > 0) {
+    if (bitsLeft_ == 0) {
+      if (bytes_ == 0) return false;
+      int c = in_.read();
+      if (c < 0) return false;
+      byte_ = (uint8_t)c;
+      bytes_--;
+      bitsLeft_ = 8;
+    }
+    uint8_t take = n < bitsLeft_ ? n : bitsLeft_;
+    uint32_t bits = (byte_ >> (bitsLeft_ - take)) & ((1u << take) - 1);
+    v = (v << take) | bits;
+    bitsLeft_ -= take;
+    n -= take;
+  }
+  return true;
+}
+
+// n비트 2의 보수 -> 부호 있는 값
+bool HistoryLogReader::readSigned(uint8_t n, int32_t& v) {
+  uint32_t u;
+  if (!readBits(n, u)) return false;
+  if (n < 32 && (u & (1u << (n - 1)))) u |= ~((1u << n) - 1);
+  v = (int32_t)u;
+  return true;
+}
+
+bool HistoryLogReader::readField(int32_t prev, int32_t& v) {
+  uint32_t b;
+  int32_t d = 0;
+  if (!readBits(1, b)) return false;
+  if (b != 0) {
+    if (!readBits(1, b)) return false;
+    if (b == 0) {
+      if (!readSigned(6, d)) return false;
+    } else {
+      if (!readBits(1, b)) return false;
+      if (!readSigned(b == 0 ? 12 : 17, d)) return false;
+    }
+  }
+  v = prev + d;
+  return true;
+}
+
+bool HistoryLogReader::next(int32_t& hour, PackedObs& s) {
+  if (end_) return false;
+
+  if (left_ == 0) {
+    if (!beginBlock()) { end_ = true; return false; }
+  }
+
+  bool ok;
+  if (index_ == 0) {
+    uint32_t h, t, r, reh, w, v;
+    ok = readBits(32, h) && readBits(16, t) && readBits(16, r) &&
+         readBits(8, reh) && readBits(8, w) && readBits(8, v);
+    if (ok) {
+      hour_ = (int32_t)h;
+      prev_.t10 = (int16_t)t;
+      prev_.rn10 = (uint16_t)r;
+      prev_.reh = (uint8_t)reh;
+      prev_.wsd10 = (uint8_t)w;
+      prev_.vec2 = (uint8_t)v;
+    }
+  } else {
+    uint32_t b;
+    int32_t dod = 0;
+    ok = readBits(1, b);
+    if (ok && b != 0) {
+      ok = readBits(1, b) && readSigned(b == 0 ? 7 : 32, dod);
+    }
+    int32_t t, r, reh, w, v;
+    ok = ok && readField(prev_.t10, t) && readField(prev_.rn10, r) &&
+         readField(prev_.reh, reh) && readField(prev_.wsd10, w) && readField(prev_.vec2, v);
+    if (ok) {
+      delta_ += dod;
+      hour_ += delta_;
+      prev_.t10 = (int16_t)t;
+      prev_.rn10 = (uint16_t)r;
+      prev_.reh = (uint8_t)reh;
+      prev_.wsd10 = (uint8_t)w;
+      prev_.vec2 = (uint8_t)v;
+    }
+  }
+  if (!ok) { end_ = true; return false; }
+
+  index_++;
+  left_--;
+  // 블록 끝: 마지막 바이트의 남은 비트와 남은 본문은 버린다.
+  if (left_ == 0 && !skip(bytes_)) end_ = true;
+
+  hour = hour_;
+  s = prev_;
+  return true;
+}
+
+// =============================
+// 모으기 / 파일
+// =============================
+static uint8_t stagedNx = 0, stagedNy = 0;
+static int stagedCount = 0;
+static int32_t stagedHours[HISTORY_LOG_BATCH];
+static PackedObs stagedSamples[HISTORY_LOG_BATCH];
+
+bool historyLogStage(uint8_t nx, uint8_t ny, int32_t hour, const PackedObs& s, bool forecast) {
+  if (forecast) return false;
+  if (stagedCount > 0 && (nx != stagedNx || ny != stagedNy)) historyLogFlush();
+  if (stagedCount == HISTORY_LOG_BATCH) historyLogFlush();
+  stagedNx = nx;
+  stagedNy = ny;
+
+  // 시각 순서로 끼워 넣는다. (간격이 일정해야 잘 줄어든다)
+  int i = stagedCount;
+  while (i > 0 && stagedHours[i - 1] > hour) i--;
+  if (i > 0 && stagedHours[i - 1] == hour) {
+    stagedSamples[i - 1] = s;
+    return true;
+  }
+  memmove(&stagedHours[i + 1], &stagedHours[i], (stagedCount - i) * sizeof(stagedHours[0]));
+  memmove(&stagedSamples[i + 1], &stagedSamples[i], (stagedCount - i) * sizeof(stagedSamples[0]));
+  stagedHours[i] = hour;
+  stagedSamples[i] = s;
+  stagedCount++;
+  return true;
+}
+
+int historyLogPending() {
+  return stagedCount;
+}
+
+#ifdef OBS_CACHE_LITTLEFS
+#define HISTORY_LOG_PATH "/history.log"
+#define HISTORY_LOG_OLD_PATH "/history.old"
+
+bool historyLogFlush() {
+  if (stagedCount == 0) return true;
+
+  uint8_t block[HISTORY_LOG_BLOCK_MAX];
+  size_t n = historyLogEncode(stagedNx, stagedNy, stagedHours, stagedSamples, stagedCount,
+                              block, sizeof(block));
+  stagedCount = 0;
+  if (n == 0) return false;
+
+  // 너무 커졌으면 이전 파일로 돌린다. (읽을 때 이전 파일부터)
+  File f = LittleFS.open(HISTORY_LOG_PATH, "r");
+  size_t size = f ? f.size() : 0;
+  if (f) f.close();
+  if (size + n > HISTORY_LOG_MAX_BYTES) {
+    LittleFS.remove(HISTORY_LOG_OLD_PATH);
+    LittleFS.rename(HISTORY_LOG_PATH, HISTORY_LOG_OLD_PATH);
+  }
+
+  f = LittleFS.open(HISTORY_LOG_PATH, "a");
+  if (!f) return false;
+  bool ok = f.write(block, n) == n;
+  f.close();
+  return ok;
+}
+
+// 다른 격자 블록은 읽지 않고 파일 위치만 옮긴다.
+class FileLogReader : public HistoryLogReader {
+public:
+  FileLogReader(File& f, uint8_t nx, uint8_t ny) : HistoryLogReader(f, nx, ny), file_(f) {}
+
+protected:
+  bool skip(uint16_t n) override { return n == 0 || file_.seek(n, SeekCur); }
+
+private:
+  File& file_;
+};
+
+static int loadFile(const char* path, uint8_t nx, uint8_t ny, int32_t fromHour, int32_t toHour,
+                    void (*fn)(void* ctx, int32_t hour, const PackedObs& s), void* ctx) {
+  File f = LittleFS.open(path, "r");
+  if (!f) return 0;
+
+  FileLogReader reader(f, nx, ny);
+  int32_t hour;
+  PackedObs s;
+  int n = 0;
+  while (reader.next(hour, s)) {
+    if (hour < fromHour || hour > toHour) continue;
+    fn(ctx, hour, s);
+    n++;
+  }
+  f.close();
+  return n;
+}
+
+int historyLogLoad(uint8_t nx, uint8_t ny, int32_t fromHour, int32_t toHour,
+                   void (*fn)(void* ctx, int32_t hour, const PackedObs& s), void* ctx) {
+  return loadFile(HISTORY_LOG_OLD_PATH, nx, ny, fromHour, toHour, fn, ctx) +
+         loadFile(HISTORY_LOG_PATH, nx, ny, fromHour, toHour, fn, ctx);
+}
+
+void historyLogClear() {
+  stagedCount = 0;
+  LittleFS.remove(HISTORY_LOG_OLD_PATH);
+  LittleFS.remove(HISTORY_LOG_PATH);
+}
+#else
+bool historyLogFlush() { stagedCount = 0; return true; }
+
+int historyLogLoad(uint8_t, uint8_t, int32_t, int32_t,
+                   void (*)(void*, int32_t, const PackedObs&), void*) {
+  return 0;
+}
+
+void historyLogClear() { stagedCount = 0; }
+#endif // OBS_CACHE_LITTLEFS
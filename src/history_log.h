@@ -0,0 +1,82 @@
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "weather.h"
+
+// =============================
+// 압축 기록 로그 (LittleFS)
+// =============================
+// 받은 시간별 값(PackedObs)을 플래시 파일 끝에 블록으로 덧붙인다. 재부팅 뒤 같은 격자로
+// 돌아오면 로그에서 기록을 채우므로 이미 본 시간은 다시 요청하지 않는다.
+// 블록 = 헤더 6 B (태그, nx, ny, 샘플 수, 본문 길이 2 B) + 비트 단위 본문
+//   첫 샘플: 시각 32비트, 값은 필드 그대로
+//   다음 샘플: 시각은 간격의 변화량(delta-of-delta), 값은 필드별 앞 샘플과의 차이
+//   매시간 이어지고 값이 그대로면 샘플 하나가 6비트
+// 로그가 HISTORY_LOG_MAX_BYTES를 넘으면 이전 파일로 돌리고 새로 시작한다. (플래시 최대 2배)
+// OBS_CACHE_LITTLEFS 빌드에서만 파일에 쓴다. 아니면 모아 둔 샘플을 버린다.
+
+#define HISTORY_LOG_BATCH 32           // 한 블록의 최대 샘플 수 (모아서 한 번에 씀)
+#define HISTORY_LOG_MAX_BYTES 32768
+#define HISTORY_LOG_BLOCK_MAX (6 + (32 + 56 + (HISTORY_LOG_BATCH - 1) * (34 + 5 * 20)) / 8 + 1)
+
+// count개 샘플을 블록 하나로 만든다. hours는 오름차순이 유리하지만 아니어도 된다.
+// 블록 바이트 수 (out이 모자라거나 count가 0 또는 HISTORY_LOG_BATCH보다 크면 0)
+size_t historyLogEncode(uint8_t nx, uint8_t ny, const int32_t hours[], const PackedObs samples[],
+                        int count, uint8_t* out, size_t cap);
+
+// 로그를 한 바이트씩 읽으면서 (nx, ny) 블록의 샘플만 꺼낸다. 다른 격자 블록은 길이만큼 건너뛴다.
+// 파일이 중간에 끊겼거나 깨진 곳을 만나면 거기서 끝낸다. (그 앞의 샘플은 그대로 유효)
+class HistoryLogReader {
+public:
+  HistoryLogReader(Stream& in, uint8_t nx, uint8_t ny);
+  virtual ~HistoryLogReader() {}
+
+  // 다음 샘플, 끝이면 false
+  bool next(int32_t& hour, PackedObs& s);
+
+protected:
+  // n바이트 건너뛰기. 기본은 한 바이트씩 읽어 버린다. (파일이면 seek로 바꿔 쓴다)
+  virtual bool skip(uint16_t n);
+
+private:
+  bool beginBlock();
+  bool readBits(uint8_t n, uint32_t& v);
+  bool readSigned(uint8_t n, int32_t& v);
+  bool readField(int32_t prev, int32_t& v);
+
+  Stream& in_;
+  uint8_t nx_, ny_;
+  uint8_t left_;        // 이번 블록에 남은 샘플 수
+  uint8_t index_;       // 이번 블록에서 몇 번째 샘플인지
+  uint16_t bytes_;      // 이번 블록 본문에서 아직 안 읽은 바이트 수
+  uint8_t byte_;        // 읽고 있는 바이트
+  uint8_t bitsLeft_;    // byte_에서 남은 비트 수
+  int32_t hour_;
+  int32_t delta_;
+  PackedObs prev_;
+  bool end_;
+};
+
+// 로그에 넣을 샘플 모으기 (격자가 바뀌면 그 전 것을 먼저 씀, 같은 시간은 덮어씀)
+// forecast: 예보로 채운 값이면 true. 관측이 아니므로 넣지 않는다. (재부팅 뒤 관측으로 읽혀서
+// 그 시간을 다시 받지 않게 되는 것을 막음) 모았으면 true
+bool historyLogStage(uint8_t nx, uint8_t ny, int32_t hour, const PackedObs& s, bool forecast);
+
+// 모아 두고 아직 쓰지 않은 샘플 수
+int historyLogPending();
+
+// 모아 둔 샘플을 블록 하나로 파일에 덧붙인다.
+bool historyLogFlush();
+
+// (nx, ny)의 fromHour .. toHour 샘플을 오래된 파일부터 차례로 fn(ctx, ...)에 넘긴다. 넘긴 수를 돌려준다.
+// 같은 시간이 여러 번 나오면 나중 것이 최신이다. 파일을 읽으므로 loop()가 아니라 fetch 작업에서 부른다.
+int historyLogLoad(uint8_t nx, uint8_t ny, int32_t fromHour, int32_t toHour,
+                   void (*fn)(void* ctx, int32_t hour, const PackedObs& s), void* ctx);
+
+// 로그 파일 지우기
+void historyLogClear();
+
+#endif // HISTORY_LOG_H
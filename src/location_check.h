@@ -0,0 +1,208 @@
+// =============================
+// location.h / location_index.h 컴파일 타임 검사
+// =============================
+// 두 헤더는 tools/gen_location.py 가 data/locations.csv 로부터 만든다.
+// 좌표 표(locationList), 이름 표(locationNameList), 인덱스가 같은 행 번호를
+// 가리키는지 빌드할 때 static_assert로 확인한다. (region.cpp 에서 한 번만 포함)
+#ifndef LOCATION_CHECK_H
+#define LOCATION_CHECK_H
+
+#include <stddef.h>
+
+#include "location.h"
+#include "location_index.h"
+#ifdef LOCATION_RASTER
+#include "location_raster.h"
+#endif
+
+namespace location_check {
+
+template <typename T, size_t N>
+constexpr size_t countOf(const T (&)[N]) { return N; }
+
+// 이름 표: 상위 지역은 항상 앞 행, 단계 수와 풀/접미사 범위가 맞아야 한다.
+constexpr bool namesWellFormed() {
+  for (int i = 0; i < locationCount; i++) {
+    const LocationName& n = locationNameList[i];
+    if (n.parent > i) return false;
+    if (n.stem >= sizeof(locationNamePool)) return false;
+    if (n.suffix >= countOf(locationNameSuffix)) return false;
+
+    int depth = 1;
+    for (int r = (int)n.parent - 1; r >= 0; r = (int)locationNameList[r].parent - 1) depth++;
+    if (depth > LOCATION_NAME_DEPTH) return false;
+  }
+  return true;
+}
+
+struct Name {
+  char s[LOCATION_NAME_MAX + 1];
+  int len;
+};
+
+// 행의 전체 이름 (region.cpp getLocationName과 같은 규칙)
+constexpr Name nameOf(int row) {
+  int parts[LOCATION_NAME_DEPTH] = {};
+  int depth = 0;
+  for (int r = row; r >= 0 && depth < LOCATION_NAME_DEPTH; r = (int)locationNameList[r].parent - 1) {
+    parts[depth++] = r;
+  }
+
+  Name name = {};
+  for (int d = depth - 1; d >= 0; d--) {
+    const LocationName& n = locationNameList[parts[d]];
+    if (d != depth - 1 && name.len < LOCATION_NAME_MAX) name.s[name.len++] = ' ';
+    for (const char* p = &locationNamePool[n.stem]; *p && name.len < LOCATION_NAME_MAX; p++) {
+      name.s[name.len++] = *p;
+    }
+    for (const char* p = locationNameSuffix[n.suffix]; *p && name.len < LOCATION_NAME_MAX; p++) {
+      name.s[name.len++] = *p;
+    }
+  }
+  return name;
+}
+
+constexpr int compareNames(const Name& a, const Name& b) {
+  for (int i = 0; i < a.len && i < b.len; i++) {
+    if (a.s[i] != b.s[i]) return (unsigned char)a.s[i] < (unsigned char)b.s[i] ? -1 : 1;
+  }
+  return a.len < b.len ? -1 : (a.len > b.len ? 1 : 0);
+}
+
+// 이름 인덱스: 모든 행이 한 번씩, strcmp 순서로 (같은 이름은 앞 행 먼저)
+constexpr bool nameOrderSorted() {
+  bool seen[locationCount] = {};
+  for (int k = 0; k < locationCount; k++) {
+    int row = locationNameOrder[k];
+    if (row >= locationCount || seen[row]) return false;
+    seen[row] = true;
+  }
+  Name prev = nameOf(locationNameOrder[0]);
+  for (int k = 1; k < locationCount; k++) {
+    Name cur = nameOf(locationNameOrder[k]);
+    int c = compareNames(prev, cur);
+    if (c > 0 || (c == 0 && locationNameOrder[k - 1] > locationNameOrder[k])) return false;
+    prev = cur;
+  }
+  return true;
+}
+
+// 행의 마지막 이름 단계를 소문자·'-' 제거로 정규화 (gen_location.py fold_token과 같은 규칙)
+constexpr Name tokenOf(int row) {
+  const LocationName& n = locationNameList[row];
+  const char* pieces[2] = { &locationNamePool[n.stem], locationNameSuffix[n.suffix] };
+  Name token = {};
+  for (const char* p : pieces) {
+    for (; *p && token.len < LOCATION_NAME_MAX; p++) {
+      if (*p == '-') continue;
+      token.s[token.len++] = (*p >= 'A' && *p <= 'Z') ? (char)(*p - 'A' + 'a') : *p;
+    }
+  }
+  return token;
+}
+
+// 단어 인덱스: 모든 행이 한 번씩, 정규화한 마지막 단계 순서로 (같으면 앞 행 먼저)
+constexpr bool tokenOrderSorted() {
+  bool seen[locationCount] = {};
+  for (int k = 0; k < locationCount; k++) {
+    int row = locationTokenOrder[k];
+    if (row >= locationCount || seen[row]) return false;
+    seen[row] = true;
+  }
+  Name prev = tokenOf(locationTokenOrder[0]);
+  for (int k = 1; k < locationCount; k++) {
+    Name cur = tokenOf(locationTokenOrder[k]);
+    int c = compareNames(prev, cur);
+    if (c > 0 || (c == 0 && locationTokenOrder[k - 1] > locationTokenOrder[k])) return false;
+    prev = cur;
+  }
+  return true;
+}
+
+// 격자 인덱스: 모든 행이 한 번씩, 자기 (gridX, gridY) 셀에 들어 있어야 한다.
+constexpr bool gridIndexMatchesRows() {
+  bool seen[locationCount] = {};
+  for (int gx = GRID_INDEX_X_MIN; gx <= GRID_INDEX_X_MAX; gx++) {
+    int c0 = gridColumnStart[gx - GRID_INDEX_X_MIN];
+    int c1 = gridColumnStart[gx - GRID_INDEX_X_MIN + 1];
+    for (int c = c0; c < c1; c++) {
+      if (c > c0 && gridCellY[c - 1] >= gridCellY[c]) return false;
+      for (int k = gridCellStart[c]; k < gridCellStart[c + 1]; k++) {
+        int row = gridCellRows[k];
+        if (row >= locationCount || seen[row]) return false;
+        if (locationList[row].gridX != gx || locationList[row].gridY != gridCellY[c]) return false;
+        seen[row] = true;
+      }
+    }
+  }
+  return gridCellStart[GRID_INDEX_CELL_COUNT] == locationCount;
+}
+
+#ifdef LOCATION_SOA
+// 좌표 열: gridCellRows 순서로 locationList 값과 같아야 한다.
+constexpr bool soaColumnsMatchRows() {
+  for (int k = 0; k < locationCount; k++) {
+    const LocationData& row = locationList[gridCellRows[k]];
+    if (locationSoaLat[k] != row.lat || locationSoaLon[k] != row.lon) return false;
+    if (locationSoaGridX[k] != row.gridX || locationSoaGridY[k] != row.gridY) return false;
+  }
+  return true;
+}
+
+static_assert(countOf(locationSoaLat) == locationCount, "locationSoaLat row count");
+static_assert(soaColumnsMatchRows(), "SoA columns do not match locationList");
+#endif // LOCATION_SOA
+
+#ifdef LOCATION_RASTER
+// 래스터: 줄마다 런이 경도 칸을 빈틈없이 덮고, 후보 목록은 정렬된 행 번호여야 한다.
+constexpr bool rasterWellFormed() {
+  if (locationRasterRowStart[0] != 0) return false;
+  for (int i = 0; i < LOCATION_RASTER_LAT_COUNT; i++) {
+    uint32_t k0 = locationRasterRowStart[i];
+    uint32_t k1 = locationRasterRowStart[i + 1];
+    if (k1 <= k0) return false;
+    for (uint32_t k = k0; k < k1; k++) {
+      const LocationRasterRun& run = locationRasterRuns[k];
+      if (k > k0 && run.end <= locationRasterRuns[k - 1].end) return false;
+      if (run.set >= LOCATION_RASTER_SET_COUNT) return false;
+    }
+    if (locationRasterRuns[k1 - 1].end != LOCATION_RASTER_LON_COUNT) return false;
+  }
+  if (locationRasterRowStart[LOCATION_RASTER_LAT_COUNT] != countOf(locationRasterRuns)) return false;
+
+  for (int s = 0; s < LOCATION_RASTER_SET_COUNT; s++) {
+    for (uint32_t k = locationRasterSetStart[s]; k < locationRasterSetStart[s + 1]; k++) {
+      if (locationRasterSetRows[k] >= locationCount) return false;
+      if (k > locationRasterSetStart[s] && locationRasterSetRows[k - 1] >= locationRasterSetRows[k]) return false;
+    }
+  }
+  return locationRasterSetStart[LOCATION_RASTER_SET_COUNT] == countOf(locationRasterSetRows);
+}
+
+static_assert(sizeof(LocationRasterRun) == 6, "LocationRasterRun layout changed");
+static_assert(countOf(locationRasterRowStart) == LOCATION_RASTER_LAT_COUNT + 1, "locationRasterRowStart size");
+static_assert(countOf(locationRasterSetStart) == LOCATION_RASTER_SET_COUNT + 1, "locationRasterSetStart size");
+static_assert(rasterWellFormed(), "location_raster.h is malformed");
+#endif // LOCATION_RASTER
+
+static_assert(sizeof(LocationData) == 12, "LocationData layout changed");
+static_assert(sizeof(LocationName) == 4, "LocationName layout changed");
+static_assert(locationCount < 4096, "LocationName.parent is 12 bits");
+
+static_assert(countOf(locationList) == locationCount, "locationList row count");
+static_assert(countOf(locationNameList) == locationCount, "locationNameList row count");
+static_assert(countOf(locationNameOrder) == locationCount, "locationNameOrder row count");
+static_assert(countOf(locationTokenOrder) == locationCount, "locationTokenOrder row count");
+static_assert(countOf(gridCellRows) == locationCount, "gridCellRows row count");
+static_assert(countOf(gridColumnStart) == GRID_INDEX_X_MAX - GRID_INDEX_X_MIN + 2, "gridColumnStart size");
+static_assert(countOf(gridCellY) == GRID_INDEX_CELL_COUNT, "gridCellY size");
+static_assert(countOf(gridCellStart) == GRID_INDEX_CELL_COUNT + 1, "gridCellStart size");
+
+static_assert(namesWellFormed(), "locationNameList: bad parent/stem/suffix");
+static_assert(nameOrderSorted(), "locationNameOrder does not match locationNameList");
+static_assert(tokenOrderSorted(), "locationTokenOrder does not match locationNameList");
+static_assert(gridIndexMatchesRows(), "grid index does not match locationList");
+
+} // namespace location_check
+
+#endif // LOCATION_CHECK_H
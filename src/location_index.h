@@ -0,0 +1,2435 @@
+// 자동 생성 파일 - 직접 수정하지 말 것
+// 원본: data/locations.csv, 생성: tools/gen_location.py
+#ifndef LOCATION_INDEX_H
+#define LOCATION_INDEX_H
+
+#include <pgmspace.h>
+#include <stdint.h>
+
+// =============================
+// 격자 버킷 인덱스 (gridX, gridY) -> locationList 행 번호
+// =============================
+// gridColumnStart[gx - GRID_INDEX_X_MIN] ~ [+1] : 해당 열의 셀 범위 (gridCellY 기준)
+// gridCellY[c]                             : 셀 c의 gridY (열 안에서 오름차순)
+// gridCellStart[c] ~ [c + 1]                : 셀 c에 속한 행 범위 (gridCellRows 기준)
+// 셀 안의 첫 행이 대표 지역 (상위 행정구역 우선, 다음은 격자 중심과 가까운 순)
+#define GRID_INDEX_X_MIN 21
+#define GRID_INDEX_X_MAX 144
+#define GRID_INDEX_CELL_COUNT 1631
+
+constexpr uint16_t gridColumnStart[] PROGMEM = {
+    0, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4, 4, 4,
+    4, 4, 5, 5, 5, 5, 7, 8, 11, 16, 23, 26, 40, 50, 65, 87,
+    110, 144, 176, 226, 271, 326, 371, 420, 469, 524, 563, 613, 654, 691, 725, 761,
+    792, 831, 860, 886, 914, 942, 965, 988, 1012, 1043, 1061, 1086, 1111, 1142, 1166, 1192,
+    1219, 1249, 1279, 1304, 1332, 1355, 1385, 1412, 1440, 1458, 1478, 1492, 1511, 1529, 1546, 1560,
+    1574, 1586, 1606, 1617, 1623, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+    1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1628, 1630, 1630, 1630, 1630, 1630,
+    1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1631,
+};
+
+constexpr uint8_t gridCellY[] PROGMEM = {
+    132, 135, 8, 64, 129, 64, 65, 95, 55, 62, 68, 62, 65, 67, 73, 75,
+    35, 58, 63, 66, 71, 109, 119, 72, 108, 128, 32, 36, 48, 58, 59, 60,
+    73, 84, 107, 109, 110, 111, 120, 131, 32, 37, 60, 62, 64, 68, 70, 104,
+    110, 130, 32, 66, 67, 71, 75, 102, 108, 109, 124, 126, 128, 129, 130, 131,
+    132, 32, 38, 61, 63, 65, 66, 67, 69, 74, 76, 77, 79, 109, 110, 111,
+    113, 120, 125, 128, 129, 130, 131, 32, 38, 57, 60, 67, 69, 71, 72, 74,
+    75, 76, 77, 79, 80, 85, 99, 102, 103, 105, 107, 110, 112, 125, 32, 33,
+    37, 38, 53, 59, 62, 64, 65, 69, 71, 72, 76, 77, 80, 81, 82, 96,
+    100, 101, 102, 104, 106, 108, 110, 112, 113, 114, 120, 124, 125, 128, 129, 130,
+    33, 38, 58, 60, 61, 65, 68, 70, 71, 72, 73, 75, 78, 80, 84, 91,
+    96, 97, 98, 99, 100, 104, 105, 112, 123, 124, 125, 126, 127, 128, 129, 130,
+    39, 53, 57, 59, 61, 63, 66, 67, 68, 69, 70, 74, 76, 79, 80, 82,
+    84, 86, 87, 91, 92, 93, 94, 95, 96, 97, 99, 101, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 118, 121, 123, 124, 125, 126, 127, 128, 129, 130,
+    132, 133, 33, 60, 61, 64, 66, 67, 68, 69, 71, 72, 75, 76, 77, 80,
+    81, 82, 83, 85, 87, 89, 91, 92, 94, 95, 96, 97, 102, 106, 107, 108,
+    109, 110, 112, 119, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 133, 56,
+    60, 61, 63, 64, 65, 70, 71, 72, 73, 74, 75, 77, 78, 79, 80, 82,
+    83, 84, 85, 86, 88, 89, 90, 91, 92, 93, 94, 95, 97, 98, 99, 101,
+    102, 103, 104, 105, 106, 108, 109, 110, 116, 119, 121, 122, 123, 124, 125, 126,
+    127, 128, 129, 130, 132, 134, 34, 56, 58, 59, 63, 65, 66, 70, 72, 73,
+    74, 75, 76, 77, 83, 84, 85, 87, 89, 90, 92, 93, 94, 99, 102, 104,
+    106, 107, 109, 110, 111, 114, 119, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+    131, 133, 136, 38, 53, 58, 60, 62, 64, 65, 69, 71, 73, 74, 75, 76,
+    77, 80, 84, 85, 86, 88, 89, 90, 91, 94, 95, 96, 97, 98, 99, 100,
+    107, 110, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 130, 135, 137, 37, 38, 59, 61, 68, 70, 71, 73, 74, 75, 76, 77,
+    78, 80, 85, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 100, 102, 104,
+    105, 109, 110, 111, 115, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+    132, 134, 137, 138, 139, 56, 63, 65, 66, 68, 70, 72, 75, 76, 77, 78,
+    79, 82, 83, 84, 86, 88, 89, 90, 92, 94, 96, 97, 98, 100, 102, 103,
+    104, 109, 110, 111, 113, 114, 115, 116, 117, 118, 119, 120, 121, 124, 125, 126,
+    127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 57, 58, 66, 71,
+    73, 76, 78, 89, 90, 91, 92, 94, 95, 96, 97, 98, 101, 108, 110, 114,
+    115, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 140, 59, 64, 66, 69, 71, 72, 75, 76, 77, 78, 79, 80, 81,
+    85, 87, 88, 89, 90, 93, 96, 97, 99, 100, 102, 103, 104, 106, 108, 110,
+    111, 112, 113, 114, 115, 117, 118, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+    129, 130, 132, 133, 136, 61, 66, 67, 68, 69, 76, 77, 79, 82, 83, 86,
+    88, 89, 91, 92, 93, 97, 104, 108, 112, 113, 114, 115, 116, 117, 119, 120,
+    122, 123, 124, 126, 127, 128, 129, 130, 131, 134, 135, 136, 140, 141, 62, 67,
+    73, 74, 76, 78, 80, 81, 85, 90, 93, 96, 97, 98, 99, 101, 103, 104,
+    105, 106, 107, 109, 110, 111, 113, 114, 115, 116, 120, 123, 124, 125, 126, 129,
+    134, 138, 139, 62, 63, 66, 69, 70, 74, 77, 79, 82, 84, 86, 91, 95,
+    99, 100, 101, 103, 104, 105, 106, 109, 110, 114, 118, 120, 121, 122, 125, 126,
+    128, 130, 132, 135, 137, 50, 60, 62, 64, 65, 66, 68, 69, 74, 77, 78,
+    79, 80, 82, 83, 85, 87, 89, 96, 98, 99, 100, 101, 102, 104, 106, 107,
+    112, 116, 118, 121, 125, 131, 140, 142, 143, 63, 71, 73, 80, 82, 84, 86,
+    88, 90, 92, 94, 96, 99, 100, 101, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 119, 121, 123, 126, 141, 59, 60, 62, 68, 70, 73, 75, 76,
+    77, 78, 79, 80, 82, 89, 95, 96, 97, 99, 100, 104, 106, 107, 108, 113,
+    114, 115, 116, 117, 118, 119, 121, 122, 123, 125, 129, 132, 133, 138, 143, 69,
+    70, 71, 75, 76, 81, 83, 85, 87, 91, 92, 94, 95, 96, 99, 100, 105,
+    109, 111, 113, 117, 119, 121, 122, 123, 124, 125, 130, 134, 68, 69, 70, 71,
+    75, 81, 86, 87, 89, 92, 98, 99, 102, 104, 106, 110, 114, 115, 117, 121,
+    125, 132, 137, 138, 140, 143, 65, 66, 71, 75, 80, 82, 83, 88, 90, 92,
+    93, 95, 101, 105, 107, 110, 111, 112, 113, 119, 122, 126, 127, 129, 132, 133,
+    134, 139, 63, 66, 67, 70, 71, 74, 80, 83, 85, 86, 95, 98, 101, 103,
+    105, 107, 111, 114, 116, 117, 119, 120, 124, 128, 133, 134, 135, 143, 63, 65,
+    66, 68, 70, 71, 73, 75, 82, 83, 93, 96, 97, 100, 102, 103, 110, 111,
+    113, 114, 121, 131, 137, 60, 70, 73, 74, 81, 82, 85, 87, 88, 93, 99,
+    102, 104, 110, 112, 114, 115, 117, 122, 125, 130, 136, 143, 67, 70, 72, 77,
+    78, 80, 81, 82, 86, 89, 92, 103, 111, 114, 115, 116, 117, 118, 121, 122,
+    123, 124, 129, 141, 66, 68, 69, 72, 74, 75, 81, 84, 85, 86, 87, 89,
+    93, 96, 97, 98, 100, 101, 103, 105, 111, 113, 114, 115, 116, 122, 123, 125,
+    126, 131, 139, 67, 71, 72, 74, 76, 78, 88, 91, 98, 106, 110, 111, 118,
+    121, 124, 134, 139, 141, 65, 67, 68, 75, 76, 79, 80, 81, 83, 85, 87,
+    91, 93, 94, 96, 102, 105, 107, 112, 120, 125, 127, 132, 136, 143, 65, 70,
+    71, 72, 73, 74, 75, 76, 86, 94, 95, 96, 97, 99, 100, 101, 103, 106,
+    108, 109, 118, 123, 124, 127, 138, 70, 72, 74, 75, 76, 78, 79, 80, 81,
+    83, 84, 87, 88, 91, 95, 96, 97, 98, 102, 104, 105, 106, 107, 113, 115,
+    116, 118, 126, 130, 139, 141, 70, 71, 72, 73, 75, 77, 79, 83, 84, 88,
+    90, 91, 92, 95, 99, 101, 103, 106, 107, 118, 119, 121, 134, 146, 68, 73,
+    74, 75, 76, 78, 81, 82, 83, 84, 86, 87, 91, 93, 97, 98, 100, 102,
+    104, 106, 110, 113, 114, 116, 120, 136, 63, 70, 72, 75, 79, 80, 81, 84,
+    86, 88, 90, 92, 94, 95, 96, 97, 100, 103, 106, 113, 115, 117, 123, 124,
+    128, 132, 147, 69, 71, 73, 75, 77, 78, 80, 82, 84, 85, 87, 88, 91,
+    93, 94, 95, 96, 97, 101, 102, 105, 107, 108, 110, 119, 120, 126, 128, 145,
+    146, 67, 68, 69, 71, 72, 74, 76, 77, 79, 82, 86, 87, 88, 89, 90,
+    91, 95, 96, 97, 99, 101, 102, 103, 106, 107, 109, 117, 119, 122, 144, 68,
+    74, 79, 80, 81, 83, 84, 85, 87, 89, 90, 92, 96, 101, 103, 105, 106,
+    108, 109, 112, 129, 138, 140, 141, 142, 66, 68, 70, 74, 77, 78, 79, 81,
+    82, 84, 89, 90, 91, 92, 93, 95, 97, 98, 99, 100, 101, 106, 110, 111,
+    113, 114, 118, 138, 68, 74, 75, 76, 77, 79, 80, 81, 85, 86, 89, 90,
+    91, 92, 110, 111, 115, 118, 120, 123, 125, 130, 137, 66, 68, 69, 76, 77,
+    82, 83, 85, 86, 89, 90, 91, 92, 95, 96, 98, 99, 101, 102, 104, 105,
+    106, 107, 108, 109, 113, 115, 121, 125, 136, 69, 70, 71, 75, 76, 77, 78,
+    79, 80, 81, 83, 86, 88, 89, 90, 91, 97, 98, 103, 105, 106, 107, 110,
+    111, 113, 123, 134, 68, 69, 74, 77, 78, 81, 82, 83, 84, 86, 89, 90,
+    94, 96, 99, 100, 102, 105, 110, 113, 118, 120, 126, 130, 131, 132, 133, 134,
+    73, 74, 75, 76, 77, 79, 80, 83, 89, 91, 92, 93, 94, 108, 112, 113,
+    131, 132, 74, 76, 77, 79, 83, 84, 86, 87, 89, 91, 92, 95, 96, 100,
+    103, 106, 114, 118, 123, 131, 74, 76, 77, 78, 80, 87, 93, 94, 100, 111,
+    114, 117, 119, 129, 73, 74, 75, 76, 77, 78, 92, 95, 100, 103, 104, 105,
+    108, 116, 118, 120, 123, 126, 127, 73, 74, 75, 76, 77, 79, 81, 88, 91,
+    94, 97, 101, 106, 108, 124, 125, 126, 127, 73, 74, 75, 76, 77, 78, 79,
+    82, 84, 85, 90, 101, 106, 109, 119, 123, 125, 74, 75, 76, 77, 78, 80,
+    81, 83, 86, 90, 96, 110, 114, 124, 75, 76, 77, 79, 82, 84, 86, 88,
+    90, 91, 93, 95, 97, 103, 78, 79, 81, 84, 89, 90, 91, 93, 102, 109,
+    118, 119, 80, 81, 83, 84, 85, 86, 88, 93, 94, 95, 96, 98, 99, 100,
+    102, 103, 106, 114, 115, 117, 83, 84, 85, 93, 94, 95, 105, 107, 109, 110,
+    111, 83, 84, 85, 87, 89, 94, 90, 92, 94, 96, 127, 127, 129, 123,
+};
+
+constexpr uint16_t gridCellStart[] PROGMEM = {
+    0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 34,
+    35, 36, 37, 38, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 67, 74, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 90, 91, 92, 93, 95, 101, 102, 103, 104, 105, 107, 109, 113,
+    115, 116, 117, 118, 119, 120, 122, 124, 126, 133, 134, 135, 136, 137, 140, 142,
+    143, 144, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 162,
+    165, 166, 175, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 192, 193, 195, 197, 198, 199, 200, 201, 202, 203, 204, 205, 207, 208, 209,
+    210, 212, 214, 215, 216, 218, 219, 220, 221, 222, 223, 224, 226, 227, 228, 229,
+    230, 231, 232, 233, 234, 238, 239, 240, 244, 249, 263, 281, 284, 287, 289, 290,
+    291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 305, 306, 307,
+    308, 310, 312, 313, 314, 321, 322, 325, 326, 327, 328, 329, 330, 331, 332, 334,
+    336, 337, 338, 339, 340, 341, 342, 343, 344, 354, 377, 397, 406, 411, 417, 419,
+    421, 422, 423, 424, 425, 426, 427, 429, 430, 431, 432, 438, 440, 441, 442, 443,
+    445, 446, 447, 448, 449, 453, 454, 456, 466, 467, 468, 469, 471, 472, 473, 474,
+    475, 476, 477, 478, 480, 487, 489, 498, 522, 533, 536, 539, 553, 558, 563, 564,
+    566, 567, 568, 570, 571, 572, 573, 575, 576, 578, 585, 588, 591, 592, 593, 594,
+    595, 596, 597, 598, 599, 600, 601, 602, 603, 605, 606, 607, 608, 610, 611, 612,
+    613, 614, 615, 616, 617, 618, 619, 620, 621, 623, 625, 631, 641, 646, 650, 668,
+    684, 688, 699, 704, 706, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+    720, 726, 733, 737, 738, 746, 748, 749, 750, 751, 752, 754, 755, 756, 757, 758,
+    759, 760, 762, 763, 764, 765, 766, 767, 776, 779, 783, 790, 821, 850, 856, 859,
+    863, 864, 865, 866, 867, 868, 869, 870, 871, 873, 874, 875, 876, 881, 911, 925,
+    927, 928, 929, 930, 931, 933, 938, 939, 940, 941, 942, 943, 944, 945, 946, 949,
+    950, 951, 952, 954, 955, 956, 957, 958, 959, 961, 963, 975, 997, 1005, 1043, 1063,
+    1088, 1096, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1109, 1121, 1125, 1126,
+    1128, 1129, 1130, 1132, 1133, 1134, 1135, 1136, 1144, 1150, 1152, 1153, 1155, 1156, 1157, 1158,
+    1159, 1160, 1161, 1166, 1167, 1168, 1169, 1170, 1180, 1191, 1196, 1208, 1215, 1234, 1257, 1288,
+    1293, 1295, 1296, 1298, 1299, 1300, 1301, 1302, 1304, 1305, 1306, 1307, 1309, 1310, 1311, 1312,
+    1315, 1316, 1317, 1318, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1328, 1329, 1331, 1332, 1333,
+    1334, 1335, 1337, 1339, 1340, 1341, 1342, 1344, 1350, 1352, 1356, 1362, 1380, 1387, 1388, 1406,
+    1425, 1459, 1488, 1507, 1513, 1521, 1522, 1525, 1533, 1534, 1535, 1536, 1538, 1539, 1540, 1543,
+    1544, 1545, 1546, 1547, 1549, 1551, 1552, 1554, 1555, 1556, 1558, 1561, 1562, 1563, 1564, 1568,
+    1575, 1577, 1580, 1585, 1589, 1599, 1611, 1624, 1634, 1640, 1660, 1682, 1700, 1709, 1712, 1715,
+    1716, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1733, 1734,
+    1735, 1736, 1737, 1747, 1765, 1769, 1770, 1771, 1772, 1774, 1775, 1778, 1782, 1783, 1784, 1786,
+    1800, 1803, 1805, 1806, 1808, 1809, 1810, 1811, 1816, 1817, 1820, 1824, 1846, 1854, 1870, 1878,
+    1884, 1885, 1886, 1887, 1889, 1890, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1901, 1902,
+    1903, 1904, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1922,
+    1925, 1927, 1929, 1931, 1939, 1941, 1944, 1945, 1946, 1947, 1950, 1951, 1952, 1953, 1955, 1956,
+    1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1973, 1974, 1979,
+    1986, 1987, 1988, 1989, 1991, 1992, 1993, 1994, 1995, 1999, 2000, 2001, 2006, 2007, 2008, 2009,
+    2010, 2011, 2012, 2014, 2016, 2017, 2018, 2019, 2020, 2021, 2024, 2025, 2026, 2028, 2030, 2031,
+    2032, 2035, 2038, 2042, 2046, 2047, 2048, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058,
+    2059, 2060, 2061, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075,
+    2076, 2078, 2081, 2083, 2085, 2086, 2087, 2088, 2089, 2090, 2094, 2113, 2118, 2119, 2120, 2122,
+    2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2141, 2142, 2143,
+    2144, 2146, 2147, 2148, 2149, 2150, 2152, 2179, 2189, 2192, 2194, 2195, 2199, 2204, 2205, 2206,
+    2208, 2209, 2210, 2211, 2212, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227,
+    2229, 2230, 2231, 2232, 2233, 2234, 2235, 2237, 2238, 2239, 2240, 2244, 2245, 2257, 2270, 2271,
+    2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2284, 2285, 2286, 2287, 2288, 2289,
+    2290, 2303, 2304, 2306, 2307, 2308, 2309, 2311, 2312, 2313, 2314, 2316, 2317, 2318, 2319, 2320,
+    2321, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337,
+    2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2348, 2349, 2350, 2351, 2354, 2355, 2356, 2358,
+    2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377,
+    2378, 2380, 2381, 2383, 2384, 2385, 2386, 2387, 2388, 2390, 2391, 2392, 2393, 2394, 2395, 2396,
+    2397, 2399, 2401, 2402, 2408, 2409, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421,
+    2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2439, 2451, 2452, 2453, 2454,
+    2461, 2467, 2468, 2471, 2473, 2475, 2476, 2479, 2480, 2481, 2482, 2484, 2486, 2487, 2488, 2489,
+    2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507,
+    2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2520, 2521, 2522, 2523, 2524, 2526,
+    2527, 2528, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2544, 2545, 2546, 2547, 2548, 2549,
+    2552, 2553, 2554, 2555, 2556, 2557, 2559, 2561, 2562, 2563, 2565, 2566, 2567, 2568, 2571, 2572,
+    2573, 2574, 2575, 2576, 2577, 2579, 2580, 2581, 2582, 2583, 2584, 2590, 2591, 2592, 2604, 2605,
+    2607, 2608, 2609, 2611, 2612, 2613, 2614, 2615, 2616, 2618, 2619, 2620, 2621, 2622, 2623, 2624,
+    2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640,
+    2641, 2642, 2643, 2644, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657,
+    2661, 2664, 2665, 2666, 2667, 2673, 2676, 2677, 2679, 2680, 2685, 2686, 2687, 2688, 2689, 2690,
+    2691, 2692, 2693, 2694, 2695, 2696, 2697, 2699, 2701, 2702, 2703, 2709, 2711, 2712, 2713, 2714,
+    2715, 2716, 2718, 2719, 2720, 2722, 2723, 2725, 2726, 2727, 2734, 2735, 2736, 2740, 2741, 2743,
+    2744, 2745, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2765, 2766, 2767, 2768,
+    2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2779, 2781, 2782, 2783, 2785, 2786, 2787, 2788,
+    2789, 2790, 2791, 2792, 2795, 2796, 2797, 2799, 2800, 2801, 2803, 2805, 2806, 2807, 2808, 2809,
+    2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2823, 2824, 2825, 2827,
+    2828, 2829, 2830, 2831, 2832, 2833, 2835, 2842, 2843, 2844, 2845, 2846, 2847, 2850, 2851, 2853,
+    2854, 2855, 2856, 2857, 2858, 2860, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872,
+    2873, 2876, 2878, 2881, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895,
+    2897, 2898, 2899, 2903, 2904, 2905, 2906, 2907, 2908, 2912, 2913, 2914, 2915, 2916, 2918, 2919,
+    2920, 2921, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2932, 2933, 2934, 2936, 2937, 2938,
+    2944, 2945, 2946, 2947, 2948, 2950, 2951, 2953, 2954, 2957, 2960, 2961, 2962, 2963, 2964, 2965,
+    2966, 2967, 2968, 2971, 2972, 2973, 2975, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991,
+    2993, 2994, 2995, 3001, 3027, 3037, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053,
+    3054, 3055, 3056, 3057, 3060, 3061, 3062, 3064, 3078, 3086, 3087, 3088, 3089, 3090, 3091, 3094,
+    3131, 3153, 3154, 3155, 3165, 3166, 3167, 3168, 3170, 3171, 3172, 3173, 3174, 3175, 3179, 3180,
+    3184, 3185, 3186, 3187, 3188, 3191, 3195, 3206, 3207, 3208, 3209, 3210, 3211, 3213, 3214, 3215,
+    3216, 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3234, 3235, 3237, 3248, 3253, 3258,
+    3259, 3260, 3261, 3262, 3263, 3265, 3266, 3269, 3276, 3279, 3280, 3281, 3282, 3285, 3288, 3289,
+    3290, 3291, 3292, 3293, 3294, 3295, 3297, 3298, 3299, 3300, 3301, 3305, 3307, 3308, 3309, 3310,
+    3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3323, 3324, 3325, 3330, 3332, 3333,
+    3334, 3335, 3336, 3337, 3340, 3341, 3342, 3343, 3344, 3346, 3348, 3349, 3350, 3351, 3352, 3353,
+    3354, 3355, 3363, 3365, 3366, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381,
+    3382, 3383, 3384, 3385, 3386, 3387, 3388, 3390, 3392, 3396, 3397, 3398, 3399, 3405, 3406, 3407,
+    3408, 3409, 3411, 3416, 3417, 3422, 3430, 3436, 3445, 3446, 3447, 3448, 3449, 3450, 3452, 3453,
+    3454, 3455, 3456, 3457, 3458, 3459, 3460, 3464, 3465, 3503, 3520, 3530, 3535, 3540, 3541, 3542,
+    3543, 3544, 3545, 3546, 3547, 3549, 3550, 3551, 3554, 3557, 3559, 3566, 3588, 3619, 3632, 3635,
+    3636, 3637, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3650, 3654, 3666, 3675, 3677, 3678,
+    3680, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3695, 3697, 3698, 3699, 3700, 3701,
+    3702, 3708, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3724, 3725, 3726, 3727, 3728, 3729,
+    3730, 3731, 3732, 3733, 3734, 3740, 3758, 3760, 3763, 3764, 3765, 3773, 3780, 3781, 3782, 3783,
+    3784, 3785, 3787, 3788, 3789, 3792, 3793, 3794, 3795, 3798, 3799, 3801, 3802, 3804, 3805, 3806,
+    3807, 3808, 3816, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 3829, 3830, 3831,
+};
+
+constexpr uint16_t gridCellRows[] PROGMEM = {
+    997, 996, 3359, 3360, 2631, 1001, 2630, 2629, 3620, 2622, 2632, 2628, 2633, 2635, 2637, 2627,
+    2589, 3319, 2621, 2620, 2634, 2636, 2626, 2315, 998, 2624, 2314, 993, 3342, 3315, 3320, 2619,
+    2615, 2616, 2617, 2566, 3830, 2313, 2309, 2310, 2316, 2317, 1000, 991, 3345, 3316, 2618, 2544,
+    2545, 2625, 2567, 2311, 2183, 992, 3358, 2623, 2330, 2331, 2328, 2322, 2327, 2329, 2326, 2332,
+    2320, 2321, 2335, 2319, 2334, 2325, 2324, 2323, 2336, 2333, 2565, 2564, 2587, 2312, 2182, 2181,
+    848, 995, 985, 986, 987, 988, 989, 3357, 3338, 3339, 2542, 2543, 2548, 2341, 2338, 2318,
+    2561, 2342, 2339, 2340, 2337, 2563, 2570, 2586, 2580, 2581, 2588, 2194, 2193, 2179, 2191, 2190,
+    2192, 2185, 2184, 2180, 999, 847, 984, 983, 980, 982, 990, 981, 3356, 3355, 3313, 3336,
+    3340, 3329, 3335, 3328, 3337, 2536, 2534, 2560, 2562, 2558, 2573, 2559, 2568, 2569, 2571, 2584,
+    2585, 2578, 2579, 3807, 3808, 3824, 2160, 2147, 2148, 2293, 2189, 2186, 2221, 844, 3350, 3348,
+    3347, 3349, 3341, 3354, 3353, 3334, 3314, 3323, 3325, 3330, 3324, 3322, 3327, 3326, 3331, 2605,
+    2613, 2535, 2541, 2557, 2556, 2402, 2572, 2574, 2583, 2582, 3806, 3809, 3812, 2272, 2157, 2156,
+    2155, 2149, 2146, 2291, 2292, 2294, 2188, 2187, 2222, 2219, 2220, 1551, 837, 846, 845, 1795,
+    1792, 1796, 3352, 3351, 3333, 3332, 2537, 2533, 2531, 2532, 2555, 2552, 2401, 2403, 2404, 2575,
+    2576, 2577, 3811, 3805, 3825, 3621, 2271, 2152, 2145, 2151, 2144, 2159, 2158, 2154, 2286, 2295,
+    2216, 2228, 2229, 2230, 895, 897, 894, 898, 896, 994, 861, 868, 866, 867, 862, 865,
+    839, 840, 841, 885, 869, 884, 864, 849, 836, 852, 854, 851, 850, 853, 855, 842,
+    856, 859, 858, 860, 857, 843, 863, 838, 872, 960, 959, 961, 977, 978, 973, 1804,
+    1803, 1794, 1797, 3318, 2611, 2606, 2538, 2539, 2540, 2554, 2553, 2551, 2400, 2399, 1101, 2596,
+    2595, 3810, 3804, 3816, 3823, 3829, 3827, 3828, 3822, 3611, 3636, 3633, 3635, 3624, 3634, 3637,
+    3622, 2260, 2259, 2261, 2262, 2270, 2269, 2153, 2246, 2150, 2290, 2289, 2284, 2285, 2093, 2287,
+    2304, 2305, 2223, 2224, 2218, 2227, 1815, 1662, 883, 888, 893, 918, 919, 889, 892, 891,
+    886, 887, 835, 881, 880, 902, 876, 882, 879, 900, 904, 878, 875, 901, 905, 874,
+    877, 907, 870, 916, 871, 873, 906, 910, 890, 920, 970, 972, 929, 971, 923, 927,
+    930, 928, 941, 969, 922, 966, 921, 967, 942, 932, 965, 964, 968, 956, 944, 958,
+    945, 963, 931, 946, 962, 951, 975, 979, 976, 957, 1801, 1791, 1798, 974, 1800, 1802,
+    1799, 1598, 1805, 1758, 1759, 1745, 1749, 3343, 2525, 2524, 2526, 2546, 2547, 2549, 2550, 2398,
+    2396, 2410, 2414, 2411, 2415, 2412, 2405, 2413, 1102, 1098, 2594, 3802, 3803, 3815, 3813, 3814,
+    3819, 3817, 3820, 3818, 3821, 3731, 3612, 3613, 3610, 3628, 3629, 3630, 3627, 3631, 3626, 3632,
+    3625, 3623, 2264, 2267, 2268, 2250, 2249, 2282, 2288, 2303, 2298, 2306, 2217, 2226, 1814, 1813,
+    1651, 1652, 1653, 1655, 1654, 1656, 1657, 1650, 917, 899, 914, 913, 908, 911, 915, 909,
+    903, 912, 1448, 1460, 1447, 940, 1442, 1449, 1444, 938, 1461, 937, 1433, 1443, 1446, 1450,
+    939, 925, 1431, 1452, 1453, 1445, 936, 926, 924, 934, 943, 949, 954, 952, 948, 1469,
+    950, 947, 935, 1441, 933, 953, 955, 1793, 1584, 1585, 1583, 1587, 1574, 1594, 1595, 1593,
+    1590, 1588, 1596, 1597, 1589, 1578, 1591, 1577, 1576, 1755, 1754, 1756, 1757, 1592, 1739, 1750,
+    1752, 1753, 1751, 1740, 2602, 2603, 2523, 2522, 2519, 2520, 2527, 2529, 2409, 2416, 2406, 2407,
+    1099, 1100, 1082, 1087, 1084, 1083, 1086, 1085, 1088, 1097, 1090, 1089, 2590, 2597, 2591, 2598,
+    2599, 2600, 3671, 3672, 3673, 3674, 3826, 3718, 3725, 3726, 3616, 3617, 3618, 2263, 2265, 2266,
+    2251, 2252, 2248, 2247, 2281, 2274, 2273, 2283, 2301, 2302, 2308, 2307, 2225, 1808, 1817, 1806,
+    1810, 1539, 1530, 1543, 1820, 1547, 1542, 1550, 1661, 1549, 1540, 1548, 1545, 1649, 1544, 1541,
+    1546, 1642, 1647, 1659, 1645, 1660, 1646, 1643, 1658, 1644, 1451, 1430, 1437, 1438, 1459, 293,
+    1458, 1436, 292, 1456, 1435, 1434, 1455, 1432, 1454, 291, 1457, 1439, 1462, 1467, 1464, 1466,
+    247, 245, 1465, 243, 1468, 1463, 273, 263, 271, 249, 246, 1440, 276, 274, 275, 268,
+    1552, 1564, 1567, 1566, 1568, 1570, 1565, 1569, 1581, 1580, 1557, 1575, 1579, 1553, 1582, 1556,
+    1586, 1743, 1741, 1744, 1747, 3346, 2607, 2608, 2530, 2521, 2528, 2516, 2408, 2397, 1031, 1053,
+    1002, 1024, 1032, 1023, 1033, 1026, 1103, 1096, 1094, 1064, 1081, 1095, 1035, 1092, 1091, 1093,
+    2593, 2592, 3668, 3687, 3688, 3689, 3691, 3684, 3685, 3686, 3675, 3690, 3676, 3722, 3717, 3724,
+    3614, 3615, 3619, 3643, 2245, 2276, 2275, 2300, 2296, 2297, 2171, 2170, 2169, 1493, 1812, 1525,
+    1527, 1533, 1526, 1532, 1528, 1531, 1536, 1529, 1538, 1535, 1534, 1648, 1489, 1488, 1409, 1487,
+    1486, 1484, 1482, 1483, 1485, 300, 1470, 277, 1478, 279, 1471, 1479, 288, 285, 1480, 280,
+    1472, 289, 1473, 282, 286, 283, 1474, 1481, 278, 284, 281, 290, 287, 1475, 322, 295,
+    323, 255, 1477, 1476, 296, 237, 256, 305, 241, 242, 238, 264, 259, 240, 239, 262,
+    257, 253, 267, 251, 265, 313, 258, 314, 254, 266, 250, 261, 244, 309, 252, 272,
+    260, 248, 1573, 1572, 236, 203, 269, 270, 1561, 1555, 1571, 1554, 1563, 1560, 1559, 1746,
+    1742, 1904, 3317, 2610, 2609, 2511, 2512, 2508, 2509, 2517, 2502, 2501, 1036, 1051, 1050, 1052,
+    1041, 1017, 1044, 1021, 1043, 1045, 1018, 1028, 1019, 1020, 1042, 1046, 1049, 1047, 1057, 1029,
+    1048, 1027, 1030, 1004, 1058, 1037, 1059, 1022, 1040, 1055, 1038, 1025, 1006, 1034, 1039, 1054,
+    1075, 1077, 1073, 1076, 1060, 1074, 1063, 1062, 1068, 1069, 1056, 1061, 1065, 1079, 1080, 2442,
+    2601, 3670, 3677, 3669, 3679, 3716, 3733, 3732, 3734, 3735, 3719, 3723, 3640, 3642, 3644, 2253,
+    2254, 2255, 2242, 2243, 2244, 2280, 2299, 2172, 1492, 1499, 1494, 1818, 1809, 1816, 1807, 1811,
+    1298, 1675, 1537, 1663, 1670, 1671, 1672, 1674, 1669, 1665, 1664, 1668, 1667, 1666, 1673, 1397,
+    1412, 1398, 1413, 1402, 1401, 1399, 1403, 1400, 1404, 1414, 1410, 1405, 1415, 1406, 1416, 1417,
+    1411, 1427, 1408, 1407, 1425, 294, 301, 304, 302, 356, 303, 299, 297, 340, 324, 355,
+    341, 339, 351, 329, 352, 354, 347, 330, 346, 338, 343, 320, 319, 360, 353, 337,
+    321, 359, 357, 361, 358, 328, 348, 326, 315, 318, 298, 317, 316, 325, 327, 342,
+    344, 349, 311, 228, 227, 224, 229, 226, 223, 41, 308, 310, 307, 221, 230, 225,
+    46, 209, 231, 306, 312, 232, 207, 205, 188, 220, 215, 217, 210, 197, 211, 198,
+    219, 214, 216, 201, 213, 202, 196, 218, 233, 200, 212, 189, 235, 199, 234, 208,
+    191, 192, 204, 193, 195, 190, 194, 1558, 1858, 1562, 1748, 1899, 3344, 3321, 2518, 2510,
+    2498, 2497, 2500, 1015, 1016, 1003, 1011, 1009, 1010, 1008, 1014, 1072, 1005, 1012, 1013, 1007,
+    1066, 1067, 1078, 1071, 1070, 2433, 2432, 2441, 2440, 3798, 3680, 3678, 3728, 3729, 3720, 3721,
+    3638, 3657, 3656, 3658, 3655, 3654, 3661, 3660, 3665, 3663, 3659, 3662, 3667, 3664, 3652, 3641,
+    3639, 3645, 3653, 2256, 2279, 2277, 2137, 2128, 2177, 2161, 2176, 2162, 2173, 2174, 2168, 1498,
+    1819, 1825, 1279, 1291, 1295, 1296, 1297, 1308, 1307, 1292, 1306, 1299, 1280, 1283, 1281, 1282,
+    1285, 1284, 1287, 1289, 1303, 1678, 1309, 1676, 1677, 1679, 1426, 1424, 1681, 1421, 1682, 1680,
+    1419, 1423, 1422, 1420, 1602, 1418, 1429, 1428, 1599, 1605, 1600, 1604, 1606, 1603, 1601, 377,
+    373, 333, 374, 368, 375, 334, 372, 376, 335, 336, 370, 332, 350, 365, 345, 369,
+    371, 331, 35, 48, 47, 37, 49, 38, 36, 51, 44, 39, 40, 50, 45, 42,
+    21, 63, 43, 29, 28, 222, 34, 30, 367, 0, 1, 19, 9, 4, 13, 10,
+    12, 119, 2, 3, 120, 26, 11, 15, 5, 20, 16, 22, 8, 17, 25, 23,
+    7, 123, 206, 24, 6, 127, 27, 126, 129, 152, 128, 148, 151, 1857, 1854, 1856,
+    1900, 1901, 1897, 1903, 2614, 2513, 2514, 2493, 2515, 2499, 2496, 2494, 2495, 2434, 2435, 2437,
+    2430, 2438, 2431, 2439, 3797, 3682, 3681, 3683, 3730, 3727, 3741, 3651, 3666, 3646, 2196, 3647,
+    2198, 2258, 2257, 2130, 2278, 2135, 2136, 2178, 2164, 2165, 2175, 2166, 2167, 1491, 1515, 1497,
+    1506, 1505, 1503, 1501, 1504, 1500, 1496, 1641, 1638, 1640, 1639, 1637, 1821, 1823, 1822, 1829,
+    1826, 1824, 1315, 1318, 1300, 1319, 1316, 1301, 1317, 1302, 1322, 1312, 1313, 1325, 1320, 1293,
+    1294, 1305, 1324, 1310, 1304, 1326, 1288, 1290, 1311, 1286, 1314, 380, 362, 394, 393, 395,
+    378, 392, 399, 396, 389, 391, 364, 379, 363, 390, 388, 366, 387, 383, 381, 64,
+    66, 386, 65, 385, 67, 82, 59, 384, 382, 62, 81, 57, 71, 58, 60, 68,
+    61, 86, 52, 118, 89, 90, 95, 88, 87, 91, 96, 92, 100, 55, 125, 97,
+    124, 69, 98, 56, 54, 134, 132, 18, 93, 99, 121, 33, 53, 94, 31, 14,
+    122, 130, 32, 139, 147, 170, 146, 156, 137, 135, 141, 169, 142, 155, 145, 136,
+    175, 138, 171, 172, 143, 154, 150, 140, 133, 179, 174, 144, 163, 161, 131, 149,
+    153, 168, 160, 159, 185, 180, 166, 165, 186, 187, 162, 183, 167, 157, 181, 164,
+    158, 182, 184, 1381, 1385, 1386, 1384, 1387, 1383, 1853, 1859, 1395, 1392, 1393, 1382, 1394,
+    1388, 1862, 1861, 1855, 1863, 1516, 1519, 1518, 1524, 1521, 1517, 1522, 1520, 1523, 1898, 1896,
+    1894, 1895, 2604, 2612, 2481, 2484, 2482, 2507, 2503, 2436, 3795, 3609, 3592, 3607, 3608, 3737,
+    3650, 3649, 3648, 2197, 2208, 2207, 2195, 2210, 2209, 2199, 2129, 2097, 2123, 2163, 2124, 2122,
+    1490, 1507, 1508, 1511, 1510, 1509, 1513, 1514, 1502, 1636, 1495, 1635, 1633, 1834, 1833, 1832,
+    1634, 1830, 1831, 1827, 1828, 1711, 1717, 1716, 1714, 1712, 1321, 1718, 1323, 1719, 1713, 1727,
+    1736, 1735, 1738, 1729, 1720, 1726, 1721, 1737, 1728, 1327, 1730, 1377, 1378, 1734, 1364, 1363,
+    1732, 1366, 1365, 1379, 1733, 1731, 1362, 1361, 1358, 1376, 1374, 1375, 1370, 1380, 1369, 1372,
+    1367, 1360, 1343, 1344, 1332, 1345, 1337, 1341, 403, 423, 420, 402, 401, 417, 418, 419,
+    416, 422, 415, 428, 400, 421, 426, 397, 398, 414, 431, 411, 70, 432, 404, 85,
+    78, 406, 83, 405, 84, 80, 444, 79, 429, 430, 446, 447, 445, 412, 427, 441,
+    77, 72, 1607, 115, 107, 106, 105, 103, 109, 104, 114, 76, 102, 108, 75, 111,
+    110, 1611, 74, 73, 101, 1608, 173, 116, 117, 1632, 112, 176, 113, 1623, 178, 177,
+    1396, 1389, 1390, 1391, 1860, 1865, 1864, 1902, 2469, 2492, 2485, 2488, 2506, 2505, 2504, 2454,
+    2451, 3794, 3790, 3791, 3796, 3792, 3801, 3780, 3743, 3585, 3587, 3584, 3586, 3588, 3589, 3590,
+    3578, 3580, 3591, 3573, 3594, 3736, 3574, 3595, 3600, 3575, 3583, 3597, 3599, 3582, 3581, 3576,
+    3596, 3577, 3593, 3579, 3601, 3606, 3739, 3604, 3605, 3745, 2206, 2202, 2201, 2200, 2131, 2127,
+    2140, 2138, 2142, 2143, 2141, 2139, 2133, 2134, 1264, 2096, 2094, 2103, 2108, 2110, 2107, 2106,
+    2119, 2104, 2117, 2105, 2120, 2111, 2121, 2109, 2125, 2126, 2118, 2112, 2115, 2113, 1776, 1512,
+    1783, 1702, 1835, 1708, 1725, 1715, 1722, 1723, 1724, 1852, 1851, 1359, 1373, 1357, 1371, 1368,
+    1328, 1346, 1349, 1354, 1348, 1350, 1355, 1338, 1331, 1353, 1339, 1351, 1330, 1340, 1329, 1335,
+    1352, 1336, 1333, 1356, 1334, 1347, 409, 1692, 408, 410, 407, 425, 1342, 424, 1694, 437,
+    451, 449, 1690, 434, 436, 435, 443, 450, 1691, 448, 1697, 442, 440, 413, 433, 1613,
+    1615, 439, 1696, 1614, 1612, 438, 1631, 1630, 1629, 1609, 1622, 1610, 1620, 1618, 1867, 1880,
+    1870, 1872, 2468, 2466, 2491, 2486, 2487, 2489, 2453, 2452, 3800, 3788, 3787, 3779, 3784, 3740,
+    3603, 3598, 3602, 3738, 3744, 3747, 2203, 1260, 1262, 2114, 2116, 1780, 1781, 1782, 1701, 1698,
+    1710, 1706, 1709, 1699, 1707, 1849, 1700, 1847, 1848, 1846, 1842, 1683, 1686, 1685, 1689, 1687,
+    1684, 1688, 1693, 1617, 1695, 1616, 1628, 1627, 1626, 1621, 1869, 1866, 1868, 1879, 1871, 1873,
+    1877, 3529, 3532, 2467, 2490, 2377, 2447, 2446, 3699, 3799, 3793, 3781, 3742, 3749, 2205, 2204,
+    2212, 2211, 2213, 2214, 2215, 2132, 1265, 1266, 1277, 1267, 1259, 1268, 1271, 1272, 1270, 1269,
+    1273, 1278, 1256, 1261, 1263, 2099, 2100, 2095, 2098, 1779, 1789, 1775, 1790, 1777, 1788, 1787,
+    1705, 1836, 1845, 1837, 1843, 1850, 1844, 1841, 1625, 1619, 1878, 1876, 3528, 3531, 2464, 2465,
+    2478, 2477, 2379, 2378, 2448, 2443, 2444, 2445, 3698, 3785, 3777, 3778, 3757, 3786, 3748, 3746,
+    1166, 1159, 1158, 1167, 1168, 1169, 1173, 1172, 1171, 1170, 1253, 1254, 1274, 1276, 1275, 1257,
+    1953, 1255, 2101, 2102, 1778, 1703, 1766, 1839, 1838, 1840, 1916, 1918, 1624, 1910, 1909, 1874,
+    1875, 2350, 2470, 2471, 2474, 2475, 2476, 2483, 2380, 2449, 2450, 3695, 3696, 3697, 3713, 3700,
+    3712, 3702, 3701, 3789, 3783, 3782, 3758, 3759, 2239, 1160, 1144, 1141, 1156, 1139, 1104, 1140,
+    1150, 1148, 1152, 1149, 1145, 1151, 1157, 1153, 1146, 1142, 1143, 1162, 1161, 1178, 1134, 1147,
+    1135, 1165, 1163, 1154, 1174, 1155, 1176, 1258, 1952, 1954, 1955, 2059, 1786, 1704, 1763, 1915,
+    1908, 3533, 3530, 3535, 2473, 2372, 2376, 3692, 3715, 3709, 3710, 3714, 3711, 3703, 3771, 3756,
+    3750, 3751, 3760, 3761, 2238, 2240, 1128, 1138, 1122, 1105, 1179, 1106, 1123, 1124, 1119, 1108,
+    1118, 1126, 1125, 1131, 1117, 1129, 1112, 1114, 1132, 1113, 1127, 1130, 1107, 1180, 1115, 1133,
+    1137, 1136, 1183, 1182, 1190, 1191, 1181, 1184, 1185, 1116, 1175, 1164, 1177, 1188, 1187, 1189,
+    1942, 1186, 1941, 1951, 1962, 1959, 1958, 1963, 1957, 1961, 1960, 1945, 1966, 2058, 2054, 2055,
+    2060, 2061, 1785, 1765, 1760, 1772, 1771, 1774, 1773, 1890, 1917, 3534, 2472, 2480, 2479, 2381,
+    2382, 2375, 2455, 2456, 2462, 2461, 2463, 3694, 3705, 3704, 3755, 2231, 2232, 2233, 2241, 1121,
+    1120, 1111, 1110, 1109, 1931, 1926, 1948, 1947, 1938, 1949, 1935, 1950, 1939, 1936, 1946, 1944,
+    1930, 1925, 1964, 1940, 1970, 1969, 1968, 1971, 1956, 1932, 1943, 1933, 1934, 1937, 1972, 2056,
+    2080, 2081, 1784, 1769, 1768, 1767, 1762, 1764, 1885, 1912, 1913, 1914, 1907, 1906, 1905, 3545,
+    3536, 2393, 2371, 2387, 2386, 2394, 2388, 2392, 2391, 2390, 2384, 2389, 2395, 2383, 2385, 2374,
+    2459, 2457, 2460, 3693, 3772, 3769, 3770, 3774, 3753, 3752, 2235, 2237, 2234, 2236, 2037, 2038,
+    1929, 1967, 1965, 2057, 2079, 1770, 1882, 1886, 1884, 1887, 1924, 1923, 3367, 1911, 2346, 2373,
+    2418, 2419, 2458, 3708, 3775, 3773, 3754, 3768, 2036, 2029, 2031, 2030, 2025, 2026, 1927, 2051,
+    2052, 2053, 2076, 2082, 1761, 2083, 1881, 1892, 1891, 1893, 1922, 3372, 3369, 3543, 3544, 3538,
+    2347, 2345, 2420, 3246, 3707, 3706, 3280, 3776, 3767, 3766, 3762, 3763, 2049, 2033, 2032, 2027,
+    1928, 2070, 2071, 2078, 2074, 2075, 1883, 1888, 1919, 1920, 3486, 3366, 3386, 3368, 3376, 3540,
+    3541, 2349, 2343, 2367, 2365, 2366, 2368, 2363, 2369, 2417, 2425, 2426, 2421, 2424, 3272, 3281,
+    3278, 3279, 2048, 2050, 2023, 2017, 2018, 2024, 2028, 2069, 2072, 1978, 1979, 1980, 3393, 1889,
+    1921, 3485, 3371, 3384, 3385, 3382, 3381, 3361, 3362, 3378, 3379, 3380, 3373, 3383, 3387, 3374,
+    3377, 3364, 3375, 3363, 3537, 2344, 2358, 2359, 2357, 2356, 2353, 2351, 2352, 2362, 2354, 2355,
+    2364, 2360, 2361, 2370, 2427, 2428, 2429, 2422, 2423, 3244, 3245, 3247, 3270, 3273, 3271, 3276,
+    2047, 2046, 2039, 2040, 2034, 2035, 2022, 2020, 2068, 2062, 2063, 2077, 1974, 3389, 3365, 3542,
+    2348, 3257, 3248, 3249, 3255, 3274, 3275, 3277, 3288, 3287, 3765, 2041, 2021, 2019, 2067, 2073,
+    1977, 1981, 1986, 3392, 3497, 3478, 3487, 3479, 3370, 3539, 3240, 3251, 3253, 3250, 3265, 3264,
+    3258, 3263, 3259, 3261, 3262, 3289, 3286, 3764, 2823, 2064, 1973, 1995, 1996, 1992, 1994, 1989,
+    1998, 1982, 1985, 3394, 3395, 3388, 3412, 3406, 3407, 3391, 3484, 3550, 3239, 3233, 3234, 3241,
+    3242, 3252, 3254, 3256, 3062, 3260, 3292, 3290, 3282, 3283, 3291, 3284, 3285, 2707, 2045, 2044,
+    2042, 2814, 2815, 2816, 2817, 2818, 2065, 1975, 1990, 1988, 1987, 1991, 1993, 1997, 1983, 1984,
+    3400, 3411, 3401, 3403, 3410, 3413, 3399, 3408, 3402, 3398, 3404, 3405, 3409, 3489, 3490, 3496,
+    3480, 3546, 3547, 3235, 3101, 3099, 3100, 3061, 3267, 3266, 3294, 2708, 2043, 2839, 2066, 1976,
+    2006, 3396, 3390, 3481, 3548, 3549, 3236, 3237, 3243, 3071, 3060, 3268, 3269, 3310, 3311, 3297,
+    3293, 2709, 2706, 2705, 2701, 2702, 2813, 2820, 2832, 2005, 3397, 3491, 3494, 3482, 3554, 3551,
+    3238, 3105, 3103, 3102, 3104, 3093, 3097, 3107, 3096, 3094, 3098, 3072, 3048, 3063, 3074, 3073,
+    3065, 3066, 3058, 3064, 3298, 2704, 2703, 2712, 2694, 2711, 2713, 2714, 2710, 2700, 2811, 2810,
+    2812, 2819, 2822, 2838, 2831, 2000, 3498, 3492, 3495, 3552, 3553, 3222, 3106, 3095, 3049, 3046,
+    3076, 3068, 3069, 3067, 3075, 3057, 3070, 3059, 3182, 3309, 3308, 3312, 3295, 3296, 3300, 3299,
+    2930, 2931, 2696, 2716, 2715, 2698, 2699, 2805, 2828, 2827, 2826, 2829, 2824, 2825, 2821, 2806,
+    2830, 2844, 2841, 2840, 2843, 2003, 2004, 2002, 2001, 1999, 2013, 2010, 2012, 2015, 2008, 2011,
+    2009, 2016, 3493, 3483, 3555, 3557, 3221, 3223, 3225, 3050, 3047, 3056, 3183, 3181, 3307, 3301,
+    2918, 2929, 2932, 2933, 2697, 2746, 2809, 2808, 2833, 2842, 2834, 2836, 2835, 2014, 2007, 3508,
+    3507, 3558, 3565, 3084, 3227, 3226, 3051, 3055, 3178, 3179, 3180, 3190, 3189, 3306, 3302, 3303,
+    2924, 2916, 2917, 2925, 2926, 2934, 2695, 2743, 2747, 2807, 2955, 2952, 2837, 2092, 2091, 2086,
+    3506, 3556, 3082, 3220, 3224, 3052, 3054, 3184, 3185, 3191, 3188, 3305, 2923, 2919, 2928, 2935,
+    2938, 2757, 2762, 2742, 2753, 2752, 2755, 2754, 2756, 2751, 2744, 2748, 2876, 2953, 2087, 2084,
+    2085, 2088, 2090, 3509, 3510, 3512, 3514, 3488, 3562, 3080, 3218, 3219, 3228, 3230, 3229, 3053,
+    3196, 3197, 3186, 3187, 3209, 3304, 2922, 2920, 2927, 2936, 2944, 2937, 2943, 2939, 2763, 2767,
+    2761, 2760, 2759, 2758, 2749, 2873, 2874, 2954, 2951, 2948, 2956, 3505, 3504, 3513, 3515, 3559,
+    3560, 3561, 3078, 3085, 3086, 3090, 3091, 3081, 3232, 3231, 3007, 3202, 3192, 3193, 3195, 3201,
+    3198, 3210, 825, 822, 816, 818, 2921, 819, 824, 2764, 2765, 2766, 2745, 828, 2872, 2875,
+    2879, 2947, 2945, 2946, 2957, 2089, 3499, 3500, 3511, 3563, 3077, 3088, 3092, 3087, 3079, 3089,
+    3006, 3199, 3205, 3214, 3203, 3204, 3211, 3207, 3208, 820, 817, 808, 821, 802, 803, 801,
+    2940, 2750, 2871, 2877, 2722, 2638, 2950, 2949, 2775, 2769, 2774, 3516, 3568, 3572, 3464, 3456,
+    3460, 3459, 3461, 3463, 3462, 3458, 3457, 3564, 3083, 3150, 3151, 3005, 3020, 3194, 3200, 3215,
+    3213, 3212, 3206, 811, 809, 810, 812, 807, 805, 712, 792, 796, 793, 795, 797, 715,
+    804, 799, 713, 728, 798, 725, 815, 743, 814, 738, 800, 742, 726, 740, 813, 723,
+    806, 714, 718, 759, 721, 719, 727, 716, 729, 724, 722, 720, 717, 764, 763, 765,
+    762, 767, 760, 761, 2941, 2942, 829, 827, 826, 2870, 2878, 2718, 2773, 2787, 2776, 2777,
+    3503, 3566, 3569, 3567, 3149, 3004, 3009, 3008, 3003, 3019, 3016, 3017, 3018, 3014, 3021, 3015,
+    3013, 3022, 3012, 3031, 3011, 3010, 3027, 3029, 3028, 3030, 3025, 3026, 3023, 3024, 2988, 3216,
+    3217, 2910, 2911, 783, 823, 786, 675, 730, 676, 768, 731, 732, 733, 776, 688, 781,
+    734, 687, 777, 683, 736, 739, 769, 678, 778, 685, 684, 771, 679, 780, 737, 782,
+    686, 680, 695, 741, 735, 770, 784, 681, 682, 794, 697, 744, 752, 753, 751, 750,
+    755, 754, 748, 749, 690, 756, 746, 691, 747, 692, 693, 694, 745, 757, 677, 696,
+    766, 758, 2772, 2768, 2783, 2770, 2785, 2780, 2779, 2784, 2782, 2786, 2781, 2778, 3502, 3522,
+    3518, 3519, 3524, 3517, 3570, 3148, 3147, 3145, 3161, 3160, 3162, 3002, 2986, 2992, 2990, 2991,
+    3138, 3139, 2909, 2912, 787, 788, 785, 775, 774, 772, 779, 689, 703, 704, 705, 700,
+    698, 702, 701, 773, 699, 707, 711, 830, 833, 831, 2869, 2861, 2862, 2863, 2723, 2724,
+    2740, 2738, 2737, 2739, 2736, 2735, 2721, 2720, 2771, 2958, 2960, 3523, 3527, 3571, 3158, 3159,
+    3157, 3163, 3152, 3154, 3153, 3032, 3037, 3036, 3038, 3039, 3035, 3040, 3041, 3042, 3034, 3033,
+    2994, 3000, 3001, 2998, 2999, 2985, 2996, 2993, 2995, 2997, 2987, 2989, 3130, 3137, 3131, 2906,
+    2907, 2853, 2857, 2856, 2855, 2845, 791, 789, 2858, 790, 2854, 706, 710, 709, 708, 832,
+    2868, 2864, 2725, 2734, 2741, 2717, 2733, 2732, 2719, 2731, 2967, 2959, 3526, 3415, 3146, 3156,
+    3155, 3043, 3111, 3109, 3136, 3143, 3142, 3140, 3141, 3128, 3144, 3132, 2908, 2860, 2848, 2859,
+    2791, 834, 2867, 2866, 2865, 2726, 2730, 2961, 3501, 3521, 3520, 3525, 3417, 3414, 3432, 3418,
+    3416, 3423, 3435, 3426, 3421, 3422, 630, 3045, 3044, 3126, 3125, 3127, 3110, 3112, 3129, 3133,
+    2852, 2850, 2847, 2846, 2849, 2790, 2792, 2729, 2966, 2962, 3433, 3429, 3431, 3428, 3434, 3430,
+    3427, 3425, 3424, 629, 631, 3121, 3119, 3120, 3117, 3116, 3118, 3113, 3135, 3134, 2915, 2914,
+    2851, 2799, 2789, 2794, 2793, 2885, 2727, 2728, 2963, 3452, 3469, 3419, 626, 627, 628, 625,
+    3108, 3123, 3122, 3124, 3114, 3167, 2913, 2788, 2800, 2803, 2801, 2804, 2802, 2796, 2886, 2965,
+    2964, 3453, 3454, 3447, 3448, 3449, 3450, 3451, 3420, 600, 601, 599, 598, 602, 588, 594,
+    593, 595, 597, 592, 596, 589, 656, 663, 667, 662, 660, 668, 555, 622, 658, 623,
+    657, 624, 557, 659, 661, 3115, 3165, 2798, 2795, 2884, 2880, 2881, 2887, 2888, 2892, 2968,
+    3455, 3466, 3473, 3446, 3441, 3440, 3442, 3445, 476, 463, 453, 457, 470, 458, 464, 473,
+    456, 471, 459, 472, 465, 467, 455, 460, 462, 454, 466, 474, 461, 468, 604, 590,
+    478, 469, 479, 491, 475, 591, 495, 496, 603, 480, 492, 493, 481, 482, 494, 502,
+    518, 517, 520, 519, 665, 516, 513, 666, 515, 514, 485, 664, 512, 511, 484, 483,
+    558, 568, 565, 567, 563, 566, 564, 556, 506, 505, 561, 559, 562, 560, 621, 3164,
+    3171, 3173, 3170, 3172, 3168, 2678, 2679, 2797, 2660, 2883, 2891, 2889, 2890, 3471, 3477, 3438,
+    3444, 3439, 3436, 3443, 3437, 500, 499, 490, 548, 498, 497, 501, 547, 549, 537, 477,
+    551, 552, 509, 553, 541, 542, 554, 521, 538, 510, 504, 522, 540, 550, 539, 503,
+    488, 487, 486, 489, 452, 523, 632, 633, 524, 640, 637, 641, 525, 634, 532, 635,
+    533, 638, 642, 528, 643, 529, 530, 644, 636, 535, 536, 508, 531, 534, 639, 649,
+    507, 607, 608, 605, 614, 619, 612, 611, 615, 620, 610, 613, 527, 606, 526, 609,
+    617, 618, 616, 3166, 3169, 1246, 1242, 1251, 2673, 2882, 2895, 2893, 3472, 3470, 3465, 3476,
+    3474, 3475, 544, 546, 545, 543, 645, 569, 655, 572, 647, 652, 646, 654, 570, 651,
+    573, 653, 581, 582, 587, 586, 580, 571, 583, 650, 648, 584, 585, 674, 3177, 3176,
+    3175, 3174, 1252, 1250, 2687, 2661, 2894, 2978, 3468, 574, 579, 578, 576, 575, 577, 669,
+    670, 672, 1248, 1244, 1249, 2677, 2688, 2684, 2686, 2683, 2691, 2685, 2670, 2689, 2690, 2680,
+    2672, 2659, 2656, 2901, 673, 671, 1243, 1240, 1201, 1214, 1215, 1216, 2692, 2693, 2682, 2681,
+    2900, 2975, 2972, 3467, 1247, 1241, 1219, 1218, 1220, 1217, 1245, 1210, 1192, 1206, 1193, 1194,
+    1198, 1211, 1213, 1199, 1209, 1195, 1196, 1197, 1200, 1212, 1207, 1204, 1208, 1202, 1203, 1205,
+    1233, 1234, 1232, 2674, 2643, 2639, 2647, 2653, 2663, 2652, 2641, 2648, 2649, 2654, 2666, 2665,
+    2662, 2667, 2664, 2668, 2655, 2657, 2658, 2899, 2898, 2896, 2897, 2905, 2979, 2969, 2973, 2970,
+    2976, 1239, 1238, 1231, 1237, 1236, 2642, 2650, 2651, 2669, 2902, 2903, 2904, 2977, 2971, 2974,
+    1221, 1227, 1223, 1224, 1225, 1226, 1222, 1229, 1230, 1228, 1235, 2676, 2675, 2644, 2671, 2645,
+    2640, 2646, 2982, 2980, 2981, 2983, 2984,
+};
+
+#ifdef LOCATION_SOA
+// =============================
+// 좌표 열 (struct-of-arrays, gridCellRows 순서) - 호스트 빌드용
+// =============================
+// k번째 값 = locationList[gridCellRows[k]] 의 각 필드.
+// 격자 버킷 구간이 그대로 연속 구간이라 배치(SIMD) 거리 계산에 바로 넣을 수 있다.
+alignas(32) constexpr int32_t locationSoaLat[] PROGMEM = {
+    37825600, 37974176, 0, 0, 34679775, 37662389, 34700492, 34752200,
+    36116581, 34293850, 34603711, 34881356, 34581997, 34752947, 34824111, 35081142,
+    35199136, 33347400, 34422492, 34402892, 34639667, 34781928, 34999728, 36759622,
+    37223581, 35058217, 36710778, 37647581, 33223572, 33407144, 33959472, 34436169,
+    34483750, 34477756, 34509381, 35107392, 35599767, 36669022, 36742667, 36754714,
+    36820631, 36866878, 37248250, 37777442, 33246372, 33458739, 34487339, 34588847,
+    34667753, 34862361, 34959142, 36517589, 36809033, 37700681, 33251025, 34789811,
+    34784219, 34782867, 34787844, 34791589, 34790000, 34787128, 34796203, 34796686,
+    34801358, 34801611, 34796050, 34808789, 34813464, 34808750, 34809867, 34806047,
+    34810708, 34803964, 35009811, 35018331, 35214783, 36417492, 36712058, 36750092,
+    37441069, 37529675, 37628908, 37659986, 37716600, 37771939, 37795825, 33248178,
+    33489603, 33496550, 34573797, 34641611, 34742908, 34801147, 34795708, 34813044,
+    34820036, 34810425, 34827214, 34807097, 34805556, 34907939, 35140175, 35236656,
+    35280169, 35392647, 35358994, 36762978, 36768442, 36782097, 36787025, 36783206,
+    36777944, 36836253, 36860644, 36936764, 37252939, 37493391, 37637825, 37683856,
+    37743858, 37710506, 37761775, 37745542, 33247475, 33244783, 33485694, 33484867,
+    33499889, 33508247, 33491894, 33506347, 33479806, 34366442, 34488200, 34848308,
+    34927661, 34987369, 35007189, 34987469, 35062744, 35062314, 35152553, 35205922,
+    35254758, 35274167, 35274900, 35374722, 35441486, 35660531, 36312222, 36435481,
+    36475836, 36577442, 36664178, 36797128, 36897183, 37490747, 33244592, 33242583,
+    33241806, 33247353, 33254060, 33260633, 33263022, 33473056, 33496311, 33508478,
+    33493858, 33511681, 33505183, 33511686, 33508386, 33500425, 33516972, 34174689,
+    34165917, 34456744, 34618517, 34696164, 34723100, 34936394, 35013842, 35065656,
+    35254033, 35298325, 35416203, 35457883, 35521286, 36149958, 36350317, 36349003,
+    36387953, 36442556, 36412192, 36529011, 36521381, 36602297, 36710839, 36807850,
+    36879597, 36923144, 36979067, 37240881, 37450419, 37499284, 37489325, 37646367,
+    37688950, 37714264, 33265578, 33260047, 33488456, 33518694, 34404997, 34517714,
+    34570436, 34562050, 34751889, 34865514, 34940244, 35016272, 35052114, 35110800,
+    35177414, 35176936, 35338006, 35436797, 35584658, 35921442, 36139325, 36195422,
+    36228781, 36301675, 36330575, 36337544, 36351736, 36333056, 36501625, 36584847,
+    36890750, 36887006, 36887006, 36887006, 37403280, 37388109, 37391058, 37413941,
+    37381672, 37443725, 37460681, 37449714, 37452322, 37453908, 37460253, 37456238,
+    37464872, 37465306, 37466461, 37423500, 37437083, 37424533, 37462044, 37471036,
+    37470933, 37481581, 37479517, 37478736, 37480444, 37473364, 37473483, 37474047,
+    37473025, 37474553, 37475461, 37469778, 37470117, 37472556, 37467243, 37467556,
+    37467526, 37531967, 37531972, 37524693, 37597691, 37592962, 37599381, 37641265,
+    37646461, 37657464, 37717372, 33531178, 34171650, 34386256, 34461047, 34564353,
+    34641989, 34776511, 34842106, 34887219, 34900714, 34965083, 35159117, 35256489,
+    35229111, 35361325, 35406889, 35511178, 35609067, 35587314, 35683394, 35712475,
+    35758700, 35919975, 35971350, 35963803, 35955825, 35969922, 35961919, 35956364,
+    35986764, 36007644, 36077406, 36074731, 36058925, 36094575, 36154850, 36207569,
+    36301397, 36387539, 36502269, 36556186, 36598361, 36598553, 36658815, 36647139,
+    36698667, 36745825, 36814614, 36840983, 36903019, 36929611, 37163656, 37321064,
+    37407122, 37408872, 37405625, 37404224, 37401453, 37416600, 37399917, 37406850,
+    37419692, 37419381, 37453233, 37441417, 37446825, 37449908, 37452294, 37434881,
+    37445644, 37449603, 37455828, 37459658, 37442086, 37453264, 37458900, 37451914,
+    37463069, 37463789, 37443769, 37429378, 37458100, 37460983, 37463364, 37459161,
+    37422200, 37504267, 37488050, 37484622, 37487953, 37489653, 37483239, 37504142,
+    37499075, 37503050, 37472972, 37491114, 37484089, 37499811, 37491433, 37505419,
+    37471000, 37512061, 37508356, 37512719, 37511797, 37542692, 37529606, 37546225,
+    37522233, 37523553, 37513928, 37540108, 37520447, 37530089, 37591114, 37594000,
+    37591172, 37561661, 37602025, 37612458, 37624639, 37614361, 37616539, 37639730,
+    37649647, 37684503, 37651661, 37720269, 37712646, 37799717, 37871583, 33276358,
+    34510378, 34543208, 34689583, 34796989, 34796667, 34815769, 34859958, 34916597,
+    35012839, 35014350, 34996736, 35000978, 34994475, 35028108, 35072878, 35031883,
+    35177697, 35216564, 35281233, 35432739, 35431386, 35486025, 35514781, 35534914,
+    35668894, 35728533, 35746619, 35726697, 35723178, 35830756, 35936517, 35910117,
+    35964642, 35970092, 35976636, 35982744, 35972536, 35961447, 35982592, 35962492,
+    35972236, 35987397, 36071697, 36118897, 36139353, 36188550, 36213803, 36424367,
+    36609011, 36655803, 36685039, 36755959, 36807053, 36882469, 37215106, 37202911,
+    37342500, 37337183, 37348186, 37362756, 37354925, 37371700, 37368358, 37388583,
+    37405690, 37444519, 37433083, 37440914, 37445994, 37456697, 37424015, 37456417,
+    37446806, 37455208, 37491810, 37484070, 37494898, 37481567, 37487808, 37500539,
+    37493975, 37492000, 37482542, 37482700, 37487409, 37497852, 37506029, 37508192,
+    37501564, 37490825, 37490920, 37482452, 37480704, 37503744, 37508972, 37483631,
+    37498042, 37507956, 37534792, 37531783, 37540956, 37525239, 37533928, 37520437,
+    37527919, 37544622, 37515628, 37513299, 37514811, 37574103, 37559167, 37603868,
+    37638822, 37647094, 37650803, 37672486, 37655908, 37671278, 37680153, 37667331,
+    37674186, 37684350, 37668700, 37690913, 37681797, 37669664, 37694325, 37674460,
+    37691794, 37723969, 37724181, 37724187, 37718998, 37702175, 37757083, 37763517,
+    37771451, 37753024, 37748839, 37850228, 34307853, 34313586, 34492261, 34569606,
+    34638911, 34632769, 34701117, 34741944, 34955200, 35022453, 35027778, 35037006,
+    35095608, 35121672, 35136428, 35139442, 35135978, 35137722, 35142103, 35126311,
+    35154742, 35181875, 35171303, 35168811, 35298811, 35285800, 35300006, 35331042,
+    35371736, 35425669, 35500778, 35553847, 35615553, 35652097, 35700978, 35769442,
+    35817531, 35856011, 35943617, 35955425, 35986686, 36034783, 36083356, 36114394,
+    36209211, 36178911, 36249744, 36271881, 36398286, 36450628, 36456269, 36516506,
+    36545978, 36603875, 36684206, 36731686, 36810575, 37086972, 37077008, 37196817,
+    37211847, 37316728, 37294755, 37307539, 37289980, 37321972, 37323730, 37342192,
+    37366318, 37335742, 37338614, 37331408, 37331584, 37337097, 37333283, 37327149,
+    37330287, 37377319, 37414856, 37378825, 37403353, 37379564, 37433503, 37440236,
+    37434006, 37435578, 37480039, 37496593, 37489241, 37486080, 37482597, 37482174,
+    37478390, 37485882, 37491106, 37470594, 37491946, 37494399, 37472841, 37487375,
+    37476219, 37485992, 37466911, 37502688, 37528348, 37529461, 37525948, 37527046,
+    37536889, 37530847, 37525155, 37530006, 37528846, 37516673, 37556106, 37539942,
+    37550269, 37519092, 37521906, 37516259, 37575942, 37568772, 37563875, 37566478,
+    37634583, 37622303, 37615594, 37627747, 37619492, 37623753, 37641808, 37612303,
+    37640142, 37646875, 37650139, 37671192, 37661272, 37656678, 37653033, 37651689,
+    37699108, 37742044, 37830236, 37793267, 37919250, 33323828, 34331603, 34391781,
+    34447336, 34641756, 34713781, 34799194, 34944181, 35043292, 35111436, 35078256,
+    35156975, 35146992, 35132083, 35162244, 35129089, 35143411, 35195582, 35197100,
+    35178511, 35183881, 35206489, 35170347, 35171290, 35216528, 35218964, 35213247,
+    35241256, 35270106, 35566872, 35562756, 35561906, 35565353, 35547072, 35566164,
+    35564597, 35554372, 35615600, 35580269, 35661911, 35730942, 35851372, 35900392,
+    35979506, 35980297, 36024567, 36061481, 36307406, 36441522, 36520958, 36598614,
+    36679806, 36675819, 36754664, 36788403, 36866117, 36980047, 37232367, 37298519,
+    37302739, 37298492, 37312625, 37293458, 37297033, 37286408, 37317900, 37289761,
+    37358900, 37330697, 37329136, 37381722, 37412861, 37418640, 37409197, 37437444,
+    37445819, 37455942, 37462339, 37461914, 37462928, 37452147, 37475750, 37492650,
+    37488022, 37490203, 37485819, 37481875, 37488025, 37497608, 37478094, 37488603,
+    37480558, 37483172, 37477400, 37488831, 37503778, 37497278, 37474292, 37471278,
+    37504978, 37477981, 37483056, 37494247, 37499386, 37475967, 37489925, 37474125,
+    37495486, 37511600, 37466533, 37468847, 37467458, 37514231, 37548156, 37523611,
+    37529533, 37532417, 37527539, 37530133, 37539853, 37542097, 37543353, 37528789,
+    37551044, 37520636, 37529892, 37516408, 37541244, 37520847, 37553067, 37535000,
+    37514247, 37548994, 37515731, 37527744, 37522172, 37522158, 37512336, 37548247,
+    37556094, 37513303, 37582661, 37597286, 37575514, 37581358, 37564606, 37558275,
+    37642781, 37642153, 37618558, 37674725, 37685231, 37650761, 37652573, 37773233,
+    37846364, 37979042, 33519336, 34176719, 34390494, 34494364, 34611767, 34678525,
+    34676658, 34720283, 34934714, 34993100, 35119036, 35109364, 35112457, 35108425,
+    35120444, 35149483, 35143617, 35147311, 35144475, 35137092, 35151728, 35142522,
+    35154314, 35153611, 35142714, 35135175, 35131597, 35133022, 35154375, 35140414,
+    35128911, 35153114, 35138797, 35146286, 35162769, 35133842, 35164375, 35161339,
+    35127478, 35158572, 35131281, 35150683, 35155453, 35121725, 35128864, 35171125,
+    35186425, 35187014, 35196208, 35186119, 35177306, 35202956, 35179675, 35170972,
+    35183694, 35181219, 35169379, 35171789, 35167242, 35219850, 35209171, 35271806,
+    35404272, 35606225, 35641858, 35685144, 35711867, 35800575, 35793008, 35802167,
+    35804450, 35799431, 35824975, 35889297, 35935733, 36057033, 36085325, 36132414,
+    36188194, 36240992, 36272822, 36272683, 36272361, 36338958, 36654742, 36800800,
+    36982853, 36964483, 37037083, 37078464, 37129542, 37158378, 37217339, 37249447,
+    37272740, 37316200, 37303189, 37358658, 37348214, 37353214, 37356808, 37359239,
+    37355697, 37343606, 37350811, 37362556, 37367197, 37370533, 37327442, 37383778,
+    37389700, 37396339, 37396983, 37391533, 37393586, 37402225, 37387217, 37393231,
+    37389700, 37394256, 37400881, 37381436, 37401575, 37388658, 37390844, 37393264,
+    37398950, 37386947, 37414281, 37416747, 37378406, 37449108, 37447292, 37449586,
+    37437519, 37461429, 37456175, 37464656, 37463294, 37475386, 37509656, 37487426,
+    37485306, 37496122, 37479735, 37496367, 37478778, 37485412, 37485309, 37497778,
+    37479151, 37486150, 37489624, 37503656, 37496564, 37476176, 37472164, 37505331,
+    37492589, 37470101, 37482630, 37470963, 37470615, 37502642, 37481442, 37505733,
+    37508172, 37498822, 37473789, 37505672, 37504622, 37509481, 37504050, 37489039,
+    37477883, 37472306, 37509475, 37544447, 37544067, 37539247, 37549656, 37544386,
+    37534900, 37531592, 37514889, 37531939, 37520398, 37544344, 37546722, 37553050,
+    37524031, 37556739, 37552433, 37514683, 37517097, 37557564, 37556869, 37576367,
+    37599969, 37560706, 37580158, 37575628, 37571122, 37591817, 37584900, 37589386,
+    37578603, 37590431, 37571194, 37589333, 37583339, 37581531, 37597911, 37576711,
+    37561694, 37595219, 37592444, 37599961, 37565931, 37601619, 37560583, 37562061,
+    37618794, 37620897, 37635600, 37615767, 37611339, 37607536, 37609019, 37649022,
+    37715097, 37700547, 37951714, 38027592, 33438750, 33503256, 34478417, 34558417,
+    34873231, 34947539, 34986844, 35116056, 35117439, 35143100, 35144906, 35151511,
+    35145886, 35154256, 35129389, 35159953, 35148114, 35141858, 35131372, 35155053,
+    35161442, 35178439, 35211919, 35171042, 35167961, 35220478, 35273156, 35298711,
+    35337242, 35429119, 35640469, 35647683, 35750561, 35791556, 35850692, 35887708,
+    35945275, 35926681, 35926511, 35934914, 35929228, 35936797, 35935331, 35945169,
+    35956842, 35957236, 35948108, 35949383, 35959731, 35952353, 36017344, 36001464,
+    36071658, 36117067, 36106967, 36167022, 36349442, 36411956, 36511783, 36549925,
+    36772561, 36787106, 36785664, 36813908, 36784239, 36775522, 36853553, 37004839,
+    37165594, 37221183, 37271844, 37254733, 37255167, 37269725, 37274344, 37273850,
+    37270481, 37259358, 37265889, 37266225, 37301011, 37299386, 37305583, 37294769,
+    37293778, 37292286, 37297667, 37302789, 37290422, 37315881, 37280514, 37341950,
+    37345069, 37350694, 37364672, 37368083, 37383944, 37386583, 37385758, 37383928,
+    37402267, 37382694, 37387592, 37395925, 37414700, 37406136, 37373339, 37379178,
+    37426372, 37445558, 37433286, 37430697, 37427294, 37421436, 37419376, 37486817,
+    37491444, 37485619, 37480558, 37497650, 37476967, 37483825, 37494758, 37477539,
+    37478186, 37482797, 37501783, 37473611, 37471789, 37480783, 37473500, 37503319,
+    37509172, 37506739, 37536094, 37537972, 37529492, 37543119, 37531886, 37542833,
+    37545881, 37523464, 37526242, 37542556, 37535869, 37517606, 37518403, 37538953,
+    37554483, 37543717, 37536250, 37549658, 37551617, 37547442, 37552033, 37554258,
+    37512089, 37563569, 37570378, 37561003, 37577253, 37582425, 37583989, 37567886,
+    37574214, 37587442, 37584137, 37573269, 37582847, 37563900, 37569211, 37571644,
+    37589856, 37559631, 37575047, 37557236, 37569075, 37575028, 37561731, 37557353,
+    37571539, 37595256, 37568303, 37559117, 37602522, 37601667, 37559311, 37598642,
+    37610786, 37638733, 37606167, 37630733, 37645194, 37821964, 37792253, 37895394,
+    38044883, 38056078, 38082556, 38133164, 34329950, 34646906, 34746806, 34712797,
+    34770592, 34884767, 34974831, 35061481, 35056919, 35174419, 35235794, 35291836,
+    35318125, 35340322, 35317489, 35361897, 35497528, 35565267, 35599622, 35618442,
+    35713572, 35771403, 35817639, 35897714, 35963408, 36075100, 36155100, 36129653,
+    36200578, 36261050, 36250261, 36327106, 36416069, 36468008, 36499275, 36758078,
+    36728847, 36797564, 36784722, 36846858, 36926858, 36962372, 37040534, 37039436,
+    37073589, 37079797, 37074844, 37063328, 37078753, 37052514, 37105400, 37137008,
+    37176640, 37183872, 37169762, 37151750, 37210219, 37208736, 37203589, 37209971,
+    37202597, 37231808, 37256311, 37253769, 37253778, 37262269, 37267631, 37248492,
+    37267250, 37240386, 37244056, 37275117, 37267556, 37238714, 37270853, 37250517,
+    37256219, 37265678, 37237819, 37279211, 37283103, 37290231, 37298986, 37287719,
+    37282539, 37290317, 37281253, 37459144, 37480786, 37488067, 37493247, 37479864,
+    37481636, 37492583, 37476028, 37479097, 37490506, 37496964, 37489250, 37467781,
+    37486000, 37497111, 37508389, 37499856, 37509042, 37508789, 37514575, 37538958,
+    37536703, 37525108, 37543528, 37530642, 37545431, 37537486, 37550347, 37514436,
+    37521339, 37544472, 37531033, 37555353, 37543786, 37555575, 37552069, 37551728,
+    37553188, 37571625, 37560611, 37586383, 37575211, 37581703, 37586259, 37583077,
+    37575818, 37569275, 37588008, 37569153, 37591731, 37563433, 37577589, 37590158,
+    37583058, 37561367, 37588494, 37558406, 37567754, 37599942, 37597331, 37572036,
+    37564986, 37595000, 37591278, 37564664, 37558336, 37568408, 37562331, 37567936,
+    37600508, 37601783, 37557228, 37636956, 37623094, 37629761, 37629386, 37635269,
+    37613772, 37611192, 37624136, 37617319, 37613361, 37638728, 37635158, 37609664,
+    37629250, 37610161, 37618206, 37624727, 37615517, 37645647, 37635972, 37624483,
+    37604203, 37642183, 37637783, 37614431, 37646194, 37645247, 37603850, 37641881,
+    37665833, 37651461, 37667000, 37675819, 37663944, 37677103, 37665436, 37661433,
+    37661711, 37658433, 37655081, 37660219, 37656228, 37649397, 37655975, 37653625,
+    37649214, 37661000, 37652089, 37735289, 37723744, 37723597, 37709194, 37728744,
+    37738006, 37782450, 37770644, 37757361, 37747531, 37746261, 37743703, 37746306,
+    37740872, 37819675, 37841364, 37872225, 37834900, 37900917, 37904992, 37898839,
+    37903208, 37895803, 37904692, 37887561, 37914908, 37926697, 37979136, 38025317,
+    38093364, 38101469, 34345692, 34426750, 34768333, 34794172, 34765517, 35026858,
+    35107381, 35246386, 35336572, 35837433, 35803936, 35872167, 35871052, 35906494,
+    35963392, 35990069, 36055731, 36122219, 36170506, 36164475, 36184203, 36199861,
+    36196347, 36239967, 36359033, 36695800, 36805933, 36779942, 36817294, 36816844,
+    36989439, 36987197, 36986481, 36993233, 36997683, 36998014, 36997103, 37015215,
+    37039767, 37132042, 37097250, 37138651, 37146914, 37163438, 37171099, 37184786,
+    37146383, 37210136, 37206282, 37203692, 37194203, 37277597, 37253946, 37258936,
+    37266545, 37269722, 37263456, 37240289, 37252774, 37244006, 37277556, 37319386,
+    37306633, 37301833, 37310331, 37316581, 37293978, 37316739, 37301131, 37299607,
+    37325122, 37292206, 37322381, 37351647, 37349365, 37338872, 37358658, 37361450,
+    37332042, 37357964, 37363136, 37336756, 37327989, 37328194, 37363997, 37369553,
+    37379969, 37388529, 37379247, 37406072, 37396756, 37392042, 37396739, 37406575,
+    37379831, 37372583, 37451886, 37422233, 37437858, 37419214, 37434583, 37462722,
+    37486028, 37487053, 37493750, 37489058, 37480533, 37500775, 37499978, 37492772,
+    37499436, 37487192, 37503131, 37504489, 37466367, 37495844, 37503356, 37485175,
+    37492144, 37500150, 37505861, 37508147, 37535739, 37527367, 37511756, 37536139,
+    37544214, 37525950, 37539675, 37535247, 37544439, 37526000, 37539786, 37531686,
+    37516444, 37515383, 37527847, 37529603, 37536972, 37511756, 37511914, 37548961,
+    37551028, 37552353, 37591625, 37589578, 37580236, 37576200, 37584561, 37571817,
+    37589611, 37583047, 37598692, 37562511, 37586983, 37597028, 37565917, 37592217,
+    37598386, 37598425, 37557475, 37557842, 37603806, 37632283, 37618569, 37603083,
+    37603431, 37646161, 37609622, 37645072, 37606797, 37661408, 37655967, 37649786,
+    37731501, 37731122, 37736922, 37755312, 37803494, 37821355, 37837219, 38180158,
+    34455972, 34665653, 34797839, 34889936, 35004197, 35068086, 35165069, 35234889,
+    35273772, 35334219, 35371389, 35373903, 35388542, 35408825, 35449908, 35660575,
+    35728911, 35783889, 35793372, 35795092, 35797717, 35793919, 35802869, 35803933,
+    35806189, 35802778, 35803581, 35817275, 35826386, 35842969, 35809189, 35824967,
+    35834742, 35820539, 35827847, 35836919, 35842367, 35818647, 35811611, 35814028,
+    35834464, 35821428, 35809689, 35806519, 35850644, 35858053, 35877367, 35860647,
+    35854167, 35992922, 36133894, 36213147, 36292617, 36275206, 36357381, 36443614,
+    36435914, 36449561, 36469317, 36471329, 36454553, 36455714, 36496603, 36605803,
+    36722318, 36719306, 36804125, 36797167, 36798111, 36792703, 36802894, 36798569,
+    36801150, 36811347, 36812181, 36808917, 36793378, 36815558, 36800028, 36785150,
+    36842756, 36837336, 36820778, 36875558, 36875825, 36915403, 36995872, 36997712,
+    37036881, 37112886, 37180663, 37249438, 37271575, 37269983, 37277073, 37277138,
+    37281160, 37349713, 37359640, 37367283, 37407997, 37416192, 37409214, 37373194,
+    37447492, 37427669, 37442236, 37436103, 37443975, 37443472, 37436914, 37446667,
+    37440733, 37430456, 37449472, 37449247, 37445853, 37452111, 37440239, 37445139,
+    37454300, 37435722, 37444867, 37425481, 37442617, 37429075, 37493222, 37477164,
+    37490686, 37494075, 37494108, 37479166, 37468235, 37484136, 37533719, 37543553,
+    37530550, 37539217, 37513431, 37550600, 37546964, 37550000, 37542303, 37520750,
+    37509158, 37523372, 37549019, 37552372, 37548717, 37512589, 37566714, 37593700,
+    37589031, 37557714, 37567044, 37590419, 37584222, 37556244, 37606597, 37604431,
+    37613528, 37608994, 37646583, 37601714, 37654144, 37723614, 37820656, 37851408,
+    37845767, 37988978, 34563611, 34526403, 34759033, 34826364, 34867536, 34926217,
+    35252583, 35294081, 35358264, 35507083, 35527261, 35566764, 35680942, 35763972,
+    35834761, 35825058, 35846872, 35934256, 35973517, 36032678, 36210508, 36496793,
+    36681251, 36875133, 36909978, 36972417, 37009553, 37056975, 37138197, 37231478,
+    37230028, 37231256, 37249647, 37275061, 37234558, 37366153, 37326650, 37391953,
+    37388978, 37419676, 37460497, 37536497, 37538917, 37535950, 37541044, 37530722,
+    37516453, 37539475, 37519406, 37585003, 37566356, 37633178, 37629283, 37645697,
+    37651747, 37696175, 37783450, 37892156, 37886236, 37895358, 37931150, 37999775,
+    38154978, 38209444, 38204472, 34572431, 34805400, 35073778, 35129922, 35232939,
+    35344258, 35394481, 35438517, 35654050, 35853008, 36019561, 36135578, 36203031,
+    36264017, 36271836, 36285631, 36300467, 36270672, 36393978, 36479036, 36486542,
+    36471270, 36489153, 36463826, 36517311, 36512042, 36511957, 36527022, 36501745,
+    36519776, 36493977, 36541874, 36592587, 36656090, 36739550, 36728239, 36782153,
+    36824583, 36940200, 36997739, 37005175, 37011306, 37020256, 37002822, 37079872,
+    37232661, 37414506, 37399763, 37382747, 37408119, 37377723, 37425890, 37491533,
+    37533067, 37649619, 37898361, 38086358, 38144056, 38144950, 34608069, 34602969,
+    34643456, 34768200, 34910686, 34971003, 35117678, 35278956, 35279167, 35269258,
+    35354536, 35504619, 35608064, 35610431, 35705533, 35670778, 35933881, 36089514,
+    36296850, 36296211, 36300911, 36341140, 36346795, 36350256, 36386791, 36388581,
+    36365331, 36357228, 36480012, 36480012, 36483522, 36478850, 36498753, 36559089,
+    36606314, 36604528, 36763614, 36773303, 36994292, 37163519, 37246111, 37301736,
+    37345925, 37463875, 37541147, 37603786, 37700783, 37814819, 37801922, 37958569,
+    38027936, 34022500, 34506967, 34568378, 34678103, 34725831, 34776286, 34844214,
+    34904967, 35148133, 35292600, 35336242, 35351628, 35375783, 35405197, 35429050,
+    35399444, 35514103, 35495492, 35560856, 35538286, 35626881, 35731356, 35834033,
+    36141328, 36252931, 36301547, 36303833, 36300617, 36302436, 36347119, 36352483,
+    36329258, 36334258, 36343756, 36327150, 36322917, 36349744, 36323618, 36351758,
+    36333694, 36313064, 36309831, 36350847, 36349519, 36342146, 36318325, 36343669,
+    36312136, 36359367, 36364628, 36360631, 36386250, 36357361, 36437469, 36527112,
+    36618200, 36618200, 36661686, 36881047, 37070169, 37160514, 37303458, 37492156,
+    37737683, 38161881, 38247014, 38309692, 34649714, 35011356, 35090336, 35413256,
+    35416797, 35407969, 35404528, 35414019, 35396536, 35510075, 35581017, 35689506,
+    35788719, 35786281, 35870131, 35972244, 36042375, 36163478, 36306728, 36304789,
+    36322631, 36324133, 36343794, 36328919, 36324844, 36331450, 36340595, 36323425,
+    36344036, 36317397, 36338904, 36322569, 36344542, 36314714, 36325417, 36344089,
+    36322600, 36332461, 36313272, 36311272, 36314081, 36350833, 36346111, 36323231,
+    36312428, 36312483, 36352014, 36373333, 36367906, 36364319, 36363450, 36362722,
+    36357722, 36355106, 36397028, 36353431, 36423170, 36437344, 36445194, 36445575,
+    36483614, 36448789, 36557506, 36614167, 36623778, 36625939, 36623292, 36658528,
+    36632606, 36641783, 36637417, 36630672, 36739431, 36781442, 36852539, 36852017,
+    36922667, 36990514, 37075706, 37220322, 37275436, 37287539, 37280064, 37279797,
+    37275386, 37398728, 37515489, 38234203, 34460592, 34498928, 34598850, 34871189,
+    34935978, 35098311, 35199458, 35205683, 35247592, 35257158, 35312753, 35387806,
+    35423819, 35489653, 35819936, 36105869, 36104289, 36127878, 36191911, 36278625,
+    36340647, 36325158, 36317461, 36314403, 36514836, 36583997, 36605825, 36607278,
+    36605889, 36615375, 36615142, 36614428, 36604142, 36621608, 36624806, 36628769,
+    36583997, 36632500, 36644306, 36637261, 36654492, 36655369, 36644306, 36663708,
+    36645019, 36636922, 36637261, 36629569, 36630281, 36632225, 36691297, 36910906,
+    36969108, 37015486, 37087658, 37129664, 37168858, 37227042, 37280833, 37336192,
+    37389831, 37488936, 37484011, 37474394, 37673450, 37822617, 37828831, 38067414,
+    38304167, 34924506, 34947606, 34946164, 34944819, 34959442, 34938758, 34952953,
+    34945417, 34944914, 34960839, 34938308, 34952214, 34949631, 34967814, 34991736,
+    35194767, 35188725, 35220117, 35436728, 35528978, 35644297, 35651147, 35730475,
+    35894156, 35963711, 36057756, 36039931, 36109589, 36165972, 36276719, 36327181,
+    36550722, 36736583, 36720894, 36843042, 36927222, 37091428, 37198928, 37300180,
+    37330214, 37372286, 37423164, 37483908, 37729394, 37882894, 34878811, 34910678,
+    34970208, 35008364, 35175139, 35461333, 35699914, 35728911, 35835178, 35970839,
+    36243272, 36303550, 36280869, 36304433, 36442442, 36491939, 36619672, 36782181,
+    36782556, 36810447, 36989242, 37031706, 37112058, 37109483, 37295358, 37298681,
+    37292153, 37309894, 37471667, 37789083, 38027167, 38056069, 38155081, 38299361,
+    34705014, 34789597, 35013808, 35185308, 35416150, 35505575, 35548647, 35782508,
+    35860431, 35942492, 36003828, 36005761, 36119297, 36391533, 36353286, 36574994,
+    36633250, 36769089, 36814067, 36872589, 36937406, 36932036, 37203214, 37326506,
+    37535742, 37553483, 37685839, 37814908, 37862486, 37895983, 37877997, 38103408,
+    38101564, 34617861, 34757311, 34766981, 34760361, 34757389, 34784475, 34766278,
+    34824983, 34937536, 34935431, 34937853, 34986319, 35120197, 35393894, 35525439,
+    35644619, 35680369, 36096436, 36235200, 36392831, 36486533, 36480558, 36476436,
+    36549064, 36657539, 36852853, 36992903, 37045272, 37104769, 37204783, 37270069,
+    37416289, 37615283, 37845125, 37855783, 37861742, 37869672, 37869436, 37882692,
+    37878542, 37882253, 37874794, 37873872, 37877861, 37873622, 37903144, 37876694,
+    37880075, 37907531, 37873814, 37923147, 38304583, 34614047, 34726889, 34723008,
+    34732439, 34738022, 34735856, 34738825, 34741811, 34765803, 34745725, 34744444,
+    34749553, 34747367, 34751503, 34872983, 34959828, 34934597, 34939403, 35016867,
+    34975331, 35064203, 35069019, 35159294, 35517469, 35477644, 35516619, 35563172,
+    36017831, 36149472, 36172058, 36168308, 36324736, 36343464, 36427747, 36466789,
+    36786964, 36812431, 36808867, 36920742, 36972769, 37309811, 37749533, 38052494,
+    34506328, 34960694, 35080078, 35106681, 35152978, 35463172, 35519133, 35625633,
+    35746558, 35774394, 36005153, 36256767, 36432833, 36509211, 36785061, 36869472,
+    36974933, 37026117, 37106939, 37359317, 37484275, 37694422, 37702792, 37691775,
+    37984606, 38291914, 34806950, 34947414, 35044242, 35019081, 35275275, 35295197,
+    35412492, 35414125, 35410347, 35455678, 35490108, 35698178, 35811819, 35966942,
+    36445353, 36833811, 36988181, 36971511, 36979144, 36968889, 36944778, 36978581,
+    37008700, 37040178, 37083658, 37167183, 37299778, 37339083, 37334561, 37349792,
+    37368742, 37408233, 37675281, 38206306, 34768300, 34834558, 34835417, 34892575,
+    34921781, 35027400, 35111575, 35179883, 35195586, 35460653, 35564706, 35640167,
+    35683625, 35684944, 35664683, 35746642, 35802367, 35987244, 36145886, 36187922,
+    36225439, 36317144, 36339542, 36386633, 36442500, 36560394, 36821314, 36902400,
+    36961303, 36971939, 36970508, 36965367, 36953108, 36983442, 37023381, 37073675,
+    37337408, 37339689, 37338406, 37323353, 37344717, 37315678, 37342761, 37352261,
+    37328781, 37349986, 37346825, 37350686, 37379519, 37488958, 37489594, 37533667,
+    37768144, 38107292, 38105200, 34796311, 35004319, 35054436, 35108919, 35229611,
+    35300925, 35295825, 35759775, 35914897, 36211633, 36597806, 36763564, 36844353,
+    37134967, 37271331, 37415142, 37865914, 38108488, 38199675, 34720569, 34827894,
+    34854711, 35163790, 35216511, 35341992, 35379681, 35432128, 35518233, 35623017,
+    35707969, 35899011, 35981844, 36029519, 36138547, 36121528, 36409308, 36528789,
+    36639753, 36882233, 37227853, 37456581, 37558172, 37813414, 37963156, 38282511,
+    34708989, 34940625, 34926597, 34925444, 34927853, 35000283, 35010353, 34966486,
+    35049444, 35079681, 35104056, 35181472, 35162383, 35180709, 35165047, 35189692,
+    35188964, 35198564, 35235950, 35195742, 35655431, 36031975, 36063053, 36110422,
+    36136897, 36125289, 36132136, 36121572, 36122249, 36177653, 36280469, 36335664,
+    36354503, 36476367, 36576514, 36689750, 36734386, 37129803, 37357422, 37409697,
+    37580925, 38066972, 38067589, 34925586, 34930644, 35053008, 35128131, 35177033,
+    35182951, 35186178, 35173086, 35180217, 35156944, 35210933, 35198447, 35296139,
+    35368828, 35411328, 35438556, 35537669, 35563617, 35562883, 35702183, 35759700,
+    35884399, 35919578, 36103056, 36124469, 36116742, 36164775, 36211294, 36407969,
+    36412347, 36414444, 36419150, 36400686, 36412539, 36426061, 36509242, 36567181,
+    36583631, 36588181, 36587217, 36595714, 36636278, 36930939, 36909153, 36997617,
+    37058719, 37129769, 37139067, 37139349, 37132832, 37146150, 37139083, 37134797,
+    37162102, 37127878, 37509436, 37710750, 38121878, 38215661, 34940317, 34996656,
+    35051017, 35091264, 35166003, 35261219, 35274644, 35338333, 35513572, 35569328,
+    35776347, 35832950, 35910320, 35948495, 36104953, 36257797, 36372089, 36463417,
+    36579158, 36600028, 36608781, 36653083, 36628311, 37128383, 37182094, 37285506,
+    37269422, 37871356, 38422886, 34842392, 35095608, 35104789, 35181922, 35231894,
+    35319119, 35318000, 35323647, 35444306, 35469228, 35544544, 35556928, 35572831,
+    35676794, 35722986, 35730542, 35919149, 35919089, 35974545, 36156906, 36239928,
+    36292867, 36423422, 36507658, 36605733, 36770469, 36934258, 36957850, 37029458,
+    37236793, 37952842, 34633208, 34933611, 35014256, 35168031, 35185208, 35345083,
+    35377500, 35430200, 35463417, 35556325, 35674869, 35766078, 35836264, 35945573,
+    36059906, 36103303, 36096736, 36116550, 36137558, 36124931, 36121358, 36136681,
+    36110994, 36115400, 36153347, 36296519, 36447381, 36605489, 36919419, 36981781,
+    36983664, 37025550, 37099431, 37367917, 37366044, 37423631, 37613389, 37771011,
+    38491644, 34900078, 34969900, 34971100, 35084753, 35052083, 35057097, 35166172,
+    35258608, 35312453, 35379475, 35481125, 35574067, 35611983, 35705192, 35746919,
+    35900842, 35992547, 35983425, 35986008, 36029831, 36048378, 36086256, 36098447,
+    36101742, 36120708, 36120061, 36117922, 36196772, 36373078, 36384597, 36545333,
+    36632500, 36687283, 36771367, 37183744, 37251644, 37498075, 37603892, 38377961,
+    38375594, 38433508, 34800317, 34833919, 34839464, 34823639, 34829575, 34896556,
+    34988664, 35038347, 35102890, 35207119, 35269406, 35269150, 35239036, 35276269,
+    35347119, 35505053, 35655764, 35694314, 35771681, 35771100, 35822783, 35858833,
+    35897944, 36104036, 36103017, 36133881, 36166783, 36251906, 36344433, 36380931,
+    36428033, 36591417, 36654950, 36654111, 36745109, 37075844, 37180861, 37184586,
+    37339186, 38326094, 34851258, 34839936, 34854250, 34843422, 34864550, 34853942,
+    35115474, 35330361, 35386042, 35455106, 35541536, 35537658, 35552519, 35625717,
+    35610586, 35693876, 35801117, 35817271, 35786642, 35852825, 35856033, 35848700,
+    35953117, 36122869, 36334389, 36470725, 36553256, 36575999, 36662389, 36718247,
+    36858553, 36868000, 36842817, 37634575, 38068683, 38147242, 38162992, 38204275,
+    38199786, 38204186, 38194306, 38195306, 38184881, 38209978, 38220894, 38254475,
+    34764011, 34833639, 34915808, 35115182, 35246810, 35308803, 35343547, 35432028,
+    35450586, 35465739, 35573356, 35807089, 35811256, 35809542, 35804467, 35812200,
+    35816650, 35868794, 35826928, 35848069, 35842942, 35850714, 35852839, 35857767,
+    35839128, 35853717, 35857675, 35864983, 35840392, 35864344, 35831486, 35833164,
+    35829836, 35844953, 35855439, 35837050, 35870800, 35832092, 35826381, 35868264,
+    35827956, 35864283, 35866783, 35898672, 35885036, 35883378, 35872242, 35878192,
+    35883786, 35872883, 35872606, 35873333, 35872722, 35942617, 35941372, 35940122,
+    35937369, 35948028, 35920722, 35918531, 35981042, 36082994, 36153878, 36236919,
+    36239997, 36297800, 36373786, 36577181, 36771797, 36826469, 36912875, 36948422,
+    37125632, 38072833, 38057797, 38077822, 34847883, 35119699, 35169568, 35138857,
+    35196874, 35220932, 35208768, 35210925, 35216100, 35205538, 35218263, 35214335,
+    35199526, 35218901, 35194093, 35217595, 35184685, 35179314, 35242217, 35249383,
+    35241045, 35249010, 35232310, 35229201, 35230185, 35233076, 35347782, 35384019,
+    35431689, 35635808, 35684303, 35812444, 35799831, 35820139, 35868542, 35842978,
+    35866286, 35855208, 35850714, 35842569, 35840856, 35853394, 35855206, 35844403,
+    35838694, 35858672, 35852786, 35856394, 35852306, 35840261, 35852500, 35862575,
+    35859683, 35856533, 35861061, 35863164, 35866250, 35838556, 35849364, 35829158,
+    35855239, 35865347, 35867119, 35834272, 35837281, 35857114, 35826350, 35869611,
+    35863203, 35855693, 35868786, 35882700, 35890531, 35889306, 35898711, 35889653,
+    35890739, 35882184, 35884272, 35889144, 35881278, 35892436, 35876211, 35876428,
+    35887375, 35876628, 35882097, 35886725, 35878950, 35910456, 35867905, 35872267,
+    35890132, 35918294, 36769228, 36802936, 36815575, 36818892, 36809561, 36820983,
+    36825847, 36807181, 36817853, 36815833, 36823556, 36976008, 37145286, 37209336,
+    37377808, 37376956, 37446036, 37670922, 38016269, 34729042, 34818408, 34877358,
+    34882599, 34889558, 34868090, 35205310, 35254003, 35253547, 35262127, 35257811,
+    35467631, 35545839, 35638811, 35660231, 35814822, 35814619, 35821889, 35852506,
+    35856897, 35855147, 35840961, 35883617, 35883889, 35877083, 35892192, 35907931,
+    35878156, 35890731, 35907283, 35869914, 35874636, 35872436, 35937222, 36097908,
+    36120144, 36192036, 36258422, 36349758, 36352992, 36419136, 36472381, 36520697,
+    36567572, 36580031, 36566200, 36558622, 36559728, 36561383, 36614033, 36682181,
+    36740150, 36890261, 36972294, 37265967, 37470686, 37966408, 34887861, 34893478,
+    34862939, 34887941, 34911450, 34983511, 34952206, 35133060, 35154983, 35154357,
+    35158645, 35149342, 35153900, 35147092, 35143347, 35137599, 35158549, 35150540,
+    35198384, 35213139, 35189741, 35216268, 35215843, 35234736, 35236228, 35251964,
+    35235943, 35221098, 35284725, 35332427, 35372436, 35418608, 35508222, 35644311,
+    35646867, 35763669, 35817600, 35810708, 35817083, 35822089, 35841272, 35834142,
+    35831528, 35840347, 35824111, 35867383, 35879699, 35870105, 35867868, 36172875,
+    36231164, 36421150, 36523206, 36556183, 36549344, 36565464, 36579381, 36563831,
+    36613483, 36739908, 36830942, 36884933, 37340182, 37889794, 34826533, 34876117,
+    34864250, 35111338, 35245956, 35301242, 35445269, 35475686, 35479975, 35491281,
+    35493989, 35500778, 35507944, 35549783, 35642389, 35816419, 35840322, 35830283,
+    36042336, 36118008, 36234583, 36303386, 36389944, 36521861, 36739006, 36883025,
+    37124256, 37224900, 37205689, 37491983, 37669856, 37749136, 37736194, 37715533,
+    37715922, 37745517, 37781011, 37761694, 37820758, 37857431, 35052617, 35101282,
+    35125896, 35197092, 35201253, 35175533, 35232708, 35317506, 35392728, 35499581,
+    35790356, 35817900, 35871031, 35910178, 35943342, 35989075, 36017367, 36658364,
+    36855967, 36907886, 37744210, 37770019, 37771731, 37765131, 37760644, 37789103,
+    37759931, 37757328, 37751894, 35123464, 35085444, 35219767, 35231950, 35259272,
+    35228492, 35233786, 35225669, 35324883, 35512183, 35581217, 35664042, 35683847,
+    35790231, 35872917, 35930336, 36056203, 36105278, 36272944, 36453033, 36565942,
+    36932242, 37128606, 37346633, 37725400, 35108091, 35084587, 35193317, 35211464,
+    35225506, 35240761, 35225881, 35218972, 35304644, 35361628, 35712589, 35970053,
+    35971556, 35961906, 35970386, 35954228, 35960614, 36018100, 36286050, 36813103,
+    36934847, 37097617, 37097225, 37161228, 37167953, 37175908, 37177625, 37150514,
+    37609881, 35056103, 35060322, 35074728, 35079819, 35078819, 35101428, 35100833,
+    35099844, 35111433, 35091533, 35096017, 35086914, 35096503, 35149467, 35151233,
+    35140992, 35160672, 35167283, 35125600, 35194181, 35209164, 35184536, 35211394,
+    35173894, 35175394, 35199636, 35181558, 35171381, 35239197, 35308039, 35912267,
+    36075500, 36287728, 36433292, 36431186, 36460133, 36526531, 36658278, 37045792,
+    37114394, 37233553, 37346867, 37487817, 37543047, 37533997, 37545639, 37555144,
+    35076906, 35094836, 35103217, 35100703, 35100686, 35097297, 35106536, 35094936,
+    35101147, 35097089, 35096858, 35092878, 35109853, 35108014, 35101933, 35094306,
+    35108508, 35098186, 35111339, 35089658, 35108047, 35110367, 35091525, 35100431,
+    35110878, 35116072, 35113447, 35086789, 35081550, 35097211, 35090392, 35091108,
+    35084906, 35118186, 35087161, 35083850, 35122908, 35122275, 35080244, 35159953,
+    35149567, 35146681, 35152686, 35141706, 35146989, 35151911, 35159700, 35144289,
+    35164914, 35154889, 35130733, 35148619, 35165922, 35160461, 35123997, 35125253,
+    35191758, 35208308, 35206819, 35207119, 35209389, 35210367, 35209267, 35203369,
+    35175625, 35169714, 35240525, 35247006, 35228772, 35221694, 35247253, 35331928,
+    35336465, 35342097, 35342736, 35349758, 35415314, 35754644, 35888408, 35998586,
+    36157222, 36341656, 36590306, 36664275, 36664161, 37414733, 37443333, 37496911,
+    37480933, 37489864, 37521931, 37549856, 37520075, 35064742, 35071794, 35088117,
+    35113789, 35088825, 35093833, 35081581, 35114411, 35119458, 35133408, 35135894,
+    35139394, 35142222, 35151269, 35135122, 35135369, 35131867, 35133031, 35143850,
+    35131464, 35158631, 35149522, 35143278, 35126711, 35125000, 35131636, 35157258,
+    35131872, 35136272, 35131986, 35127306, 35177019, 35201872, 35173186, 35191719,
+    35192975, 35183217, 35185878, 35181419, 35202708, 35184572, 35196389, 35181033,
+    35194047, 35176833, 35175772, 35204883, 35184033, 35201867, 35195933, 35185547,
+    35176131, 35201581, 35204867, 35169781, 35197175, 35194644, 35170269, 35171356,
+    35171397, 35209781, 35212375, 35240078, 35234667, 35241992, 35237406, 35226728,
+    35222531, 35252083, 35221350, 35216814, 35216967, 35215261, 35212491, 35217236,
+    35272050, 35268556, 35295208, 35320447, 35486233, 35538823, 35566372, 35587561,
+    35847011, 36353942, 36555153, 36699450, 37146914, 37344969, 37447086, 37433231,
+    37439733, 37445100, 35111750, 35110144, 35117922, 35117714, 35142467, 35160019,
+    35154167, 35159292, 35140753, 35150678, 35139575, 35151967, 35159811, 35159867,
+    35159458, 35164822, 35192831, 35198006, 35186550, 35180864, 35198056, 35168156,
+    35206103, 35172153, 35167358, 35222053, 35225764, 35272197, 35370422, 35380261,
+    35416581, 35413217, 35519086, 35640431, 35823014, 36125608, 36762261, 36935519,
+    37376436, 35158797, 35180561, 35174867, 35166061, 35167822, 35169264, 35241350,
+    35235603, 35322375, 35463131, 35565903, 35651217, 35749475, 35833586, 35838139,
+    35832297, 35838958, 35851728, 35847822, 35853169, 35861164, 35856825, 35863339,
+    35987197, 36069458, 36127089, 36445569, 35263937, 35310703, 35415903, 35530739,
+    35553300, 35546944, 35547922, 35532244, 35772028, 35831719, 35892292, 35984736,
+    36396194, 36721192, 37102008, 37173561, 35346172, 35431581, 35509861, 35521358,
+    35516581, 35523508, 35493130, 35526281, 35535408, 35540764, 35566342, 35552319,
+    35557542, 35541850, 35541389, 35551736, 35541967, 35553386, 35560306, 35565793,
+    35553517, 35533394, 35538292, 35567392, 35531611, 35567011, 35576350, 35574342,
+    35635239, 35625633, 35619753, 35712953, 35965494, 36005686, 36014019, 36014158,
+    36022311, 36005047, 35988625, 36023286, 36028889, 36038850, 36051689, 36035408,
+    36036781, 36057869, 36031840, 36067197, 36104128, 36196172, 36225900, 36283108,
+    36358933, 36412103, 36406536, 36543264, 36913106, 36990186, 36959906, 36994336,
+    37056897, 35523819, 35542936, 35579689, 35591775, 35574792, 35960197, 35994383,
+    35989311, 36066967, 36506044, 36534575, 36599431, 36675567, 36725150, 36795269,
+    35501889, 35506303, 35495031, 35490700, 35500136, 35513758, 35482975, 35521564,
+    35542944, 35536342, 35612406, 35674761, 35788092, 35985508, 35804372, 35892778,
+    35982075, 36080854, 37463769, 37480575, 37481114, 37536783, 37241439,
+};
+
+alignas(32) constexpr int32_t locationSoaLon[] PROGMEM = {
+    124714100, 124718691, 0, 0, 125431264, 125704108, 125955408, 125928633,
+    125979053, 126049075, 126038553, 126049411, 126090286, 126126667, 126114042, 126113186,
+    126139622, 126186019, 126169311, 126192164, 126150931, 126144522, 126141622, 126199311,
+    126148889, 126209589, 126230064, 126242108, 126254175, 126269086, 126296142, 126285464,
+    126265544, 126264967, 126293978, 126296542, 126295097, 126300489, 126299975, 126298333,
+    126259197, 126282631, 126313219, 126282611, 126339067, 126331467, 126345022, 126310611,
+    126329731, 126314411, 126345286, 126346500, 126351900, 126322875, 126399908, 126381731,
+    126389108, 126382664, 126394067, 126393642, 126382222, 126403689, 126385686, 126377156,
+    126395475, 126399933, 126411844, 126394419, 126401378, 126383064, 126379100, 126388600,
+    126416275, 126371486, 126396608, 126413953, 126373967, 126411222, 126395556, 126427644,
+    126404475, 126429133, 126422278, 126424156, 126391886, 126413642, 126410219, 126436778,
+    126434244, 126460153, 126438431, 126449908, 126471189, 126436567, 126420889, 126465000,
+    126443586, 126447593, 126419967, 126431864, 126422300, 126430842, 126433797, 126454711,
+    126422786, 126447419, 126448022, 126456011, 126469344, 126452164, 126461200, 126450219,
+    126461911, 126463022, 126438978, 126436378, 126485911, 126488401, 126493167, 126482419,
+    126490000, 126486886, 126465442, 126485597, 126479575, 126513411, 126500333, 126498931,
+    126470089, 126513733, 126513619, 126515686, 126479197, 126521444, 126517264, 126492367,
+    126504108, 126483700, 126517908, 126478333, 126518619, 126522222, 126499753, 126509642,
+    126477211, 126514086, 126513931, 126513667, 126497231, 126530489, 126514000, 126524575,
+    126529331, 126519353, 126535586, 126520000, 126506264, 126532997, 126563289, 126567278,
+    126568064, 126567042, 126559550, 126552733, 126569100, 126547008, 126533208, 126540319,
+    126537375, 126533708, 126527589, 126528186, 126523911, 126520300, 126567442, 126577867,
+    126569608, 126555597, 126570131, 126573808, 126572156, 126566067, 126539589, 126533422,
+    126545211, 126579533, 126562753, 126541153, 126553119, 126551656, 126591853, 126598986,
+    126571322, 126591533, 126590008, 126592531, 126548689, 126552108, 126546975, 126582678,
+    126570286, 126598953, 126592942, 126587286, 126606600, 126568727, 126554234, 126583931,
+    126599378, 126554678, 126588978, 126617622, 126596878, 126587531, 126627456, 126612022,
+    126601289, 126601264, 126586953, 126609122, 126610153, 126639344, 126605964, 126610986,
+    126603219, 126634311, 126605497, 126636886, 126607456, 126647056, 126603700, 126633808,
+    126603253, 126607033, 126614886, 126602931, 126607644, 126653411, 126626967, 126612900,
+    126630253, 126628242, 126628242, 126628242, 126641639, 126634928, 126652082, 126623231,
+    126663367, 126638889, 126652686, 126642419, 126647531, 126653967, 126649311, 126659920,
+    126636153, 126639975, 126637956, 126650286, 126666233, 126657142, 126661242, 126645367,
+    126623567, 126632222, 126644722, 126631953, 126627531, 126639189, 126642333, 126631111,
+    126644731, 126650031, 126652022, 126641944, 126648600, 126620686, 126647181, 126627156,
+    126664755, 126641014, 126653834, 126629526, 126637152, 126661329, 126663375, 126643823,
+    126623716, 126625369, 126633342, 126636233, 126653022, 126649475, 126678097, 126649867,
+    126661600, 126652597, 126645753, 126694597, 126653864, 126671844, 126699608, 126666575,
+    126648478, 126648689, 126680719, 126676133, 126673389, 126679608, 126680097, 126664042,
+    126700122, 126687264, 126681308, 126696864, 126691356, 126702833, 126701756, 126658775,
+    126709075, 126702353, 126693889, 126691789, 126708775, 126672131, 126691200, 126678478,
+    126706256, 126675678, 126693375, 126690131, 126662908, 126664289, 126672798, 126693797,
+    126667653, 126683797, 126669100, 126715389, 126690164, 126681044, 126710833, 126683665,
+    126680442, 126683978, 126680367, 126716394, 126718342, 126694156, 126671364, 126672908,
+    126703431, 126683708, 126707353, 126698911, 126691419, 126699033, 126692367, 126687097,
+    126679711, 126713675, 126707367, 126691500, 126676111, 126715422, 126711067, 126674753,
+    126689108, 126702800, 126669508, 126717286, 126675897, 126678700, 126716600, 126725178,
+    126668219, 126724100, 126686953, 126685686, 126711511, 126681878, 126710286, 126702319,
+    126713544, 126710708, 126698200, 126675097, 126720042, 126676697, 126722108, 126680375,
+    126710131, 126706533, 126676797, 126679919, 126674353, 126678200, 126714222, 126680267,
+    126711864, 126679833, 126703897, 126726575, 126676533, 126726067, 126699844, 126715600,
+    126677311, 126675708, 126725911, 126717778, 126707744, 126690978, 126719133, 126671338,
+    126673944, 126720931, 126683708, 126710798, 126720437, 126718289, 126710753, 126722089,
+    126722056, 126729942, 126711142, 126698619, 126703397, 126699075, 126751044, 126751622,
+    126712867, 126727156, 126716100, 126708953, 126712644, 126717867, 126734264, 126721444,
+    126730875, 126746811, 126740922, 126704108, 126705089, 126714197, 126705678, 126745422,
+    126713097, 126735678, 126740864, 126739019, 126725922, 126743864, 126750422, 126759000,
+    126738844, 126740131, 126731933, 126746119, 126718742, 126756519, 126720578, 126715822,
+    126713431, 126711764, 126764289, 126754967, 126754297, 126735556, 126762375, 126719378,
+    126734811, 126763242, 126741444, 126726344, 126766208, 126775522, 126741275, 126771844,
+    126750244, 126745978, 126730922, 126734453, 126728389, 126735700, 126730890, 126739794,
+    126729320, 126733797, 126749453, 126739753, 126734133, 126737711, 126752162, 126732922,
+    126726208, 126729900, 126753155, 126756101, 126760795, 126748978, 126768184, 126754390,
+    126769887, 126739222, 126769603, 126739108, 126773859, 126771441, 126762580, 126751035,
+    126737000, 126730475, 126780588, 126778956, 126780032, 126778051, 126738486, 126726533,
+    126727000, 126727931, 126739753, 126743897, 126739167, 126738553, 126731133, 126773324,
+    126731886, 126729264, 126739778, 126771315, 126729344, 126736242, 126760400, 126772777,
+    126772564, 126780400, 126786567, 126752778, 126777056, 126762467, 126757222, 126765442,
+    126772344, 126770667, 126737611, 126754305, 126779353, 126781953, 126768419, 126785982,
+    126780434, 126751558, 126751262, 126751263, 126768705, 126767663, 126781953, 126778186,
+    126778369, 126746911, 126779475, 126786200, 126757097, 126747578, 126802867, 126801256,
+    126769197, 126775578, 126773464, 126796453, 126786322, 126789442, 126755564, 126807767,
+    126774133, 126762333, 126795789, 126797197, 126796708, 126800800, 126802744, 126793600,
+    126811533, 126796086, 126809867, 126811933, 126786975, 126775056, 126787286, 126769222,
+    126809400, 126810753, 126795308, 126785308, 126773797, 126787375, 126788689, 126815822,
+    126807931, 126768153, 126813742, 126798531, 126788133, 126783978, 126804197, 126792786,
+    126808356, 126823667, 126815064, 126782644, 126778133, 126808856, 126804256, 126788619,
+    126775300, 126790422, 126799764, 126828233, 126789853, 126817367, 126833397, 126833531,
+    126823833, 126814419, 126820049, 126826600, 126812249, 126810667, 126837621, 126814622,
+    126815846, 126804722, 126827597, 126806389, 126801759, 126787156, 126790768, 126819066,
+    126786115, 126805078, 126817678, 126805556, 126786722, 126783339, 126800078, 126790597,
+    126834956, 126787131, 126799941, 126786997, 126816691, 126806681, 126810237, 126810716,
+    126806882, 126794645, 126833567, 126809745, 126788271, 126788702, 126798044, 126787040,
+    126792154, 126841608, 126822570, 126785903, 126795813, 126812011, 126805458, 126824851,
+    126829444, 126831175, 126799139, 126833600, 126790738, 126803511, 126812164, 126840464,
+    126835244, 126836764, 126842156, 126785917, 126816019, 126814311, 126808831, 126842664,
+    126834197, 126819419, 126827456, 126837964, 126838011, 126840922, 126835619, 126835122,
+    126788856, 126794575, 126835056, 126812097, 126802000, 126831722, 126791864, 126843486,
+    126829311, 126807067, 126818619, 126792353, 126840131, 126833619, 126829264, 126806397,
+    126820997, 126817108, 126814753, 126841153, 126829631, 126845308, 126832286, 126836067,
+    126853364, 126845178, 126859189, 126854019, 126860911, 126868444, 126840719, 126825751,
+    126829642, 126868600, 126862916, 126823856, 126864704, 126844244, 126826419, 126845475,
+    126814289, 126835464, 126858111, 126851142, 126852452, 126847419, 126839833, 126855375,
+    126858708, 126870864, 126844678, 126830511, 126840244, 126846019, 126822008, 126842800,
+    126852597, 126877842, 126835267, 126879019, 126856322, 126834197, 126846722, 126870556,
+    126850875, 126848267, 126879631, 126863333, 126886778, 126887456, 126875822, 126846819,
+    126862767, 126865842, 126873797, 126874331, 126851013, 126866586, 126851519, 126851873,
+    126875422, 126858756, 126863178, 126859419, 126853422, 126882850, 126899441, 126879819,
+    126887508, 126883775, 126871242, 126876853, 126879867, 126899419, 126866708, 126889597,
+    126869956, 126877856, 126864722, 126868708, 126858619, 126864800, 126872433, 126885667,
+    126857989, 126855889, 126859000, 126891222, 126860431, 126891378, 126858422, 126866600,
+    126882653, 126891986, 126895686, 126847089, 126849264, 126849264, 126900356, 126893808,
+    126900211, 126861756, 126855644, 126851067, 126899100, 126868708, 126851675, 126898342,
+    126870497, 126880753, 126873233, 126865233, 126864597, 126866600, 126873808, 126856744,
+    126873044, 126860800, 126850422, 126872697, 126849753, 126890286, 126860997, 126898022,
+    126866486, 126852244, 126856397, 126843742, 126846586, 126899522, 126856886, 126841885,
+    126850008, 126845767, 126877419, 126874731, 126896811, 126899642, 126853364, 126862686,
+    126889067, 126856500, 126845031, 126878086, 126864678, 126870152, 126893748, 126853308,
+    126884575, 126886356, 126854075, 126860997, 126900244, 126888967, 126916133, 126909108,
+    126904711, 126905464, 126898889, 126919575, 126910144, 126900644, 126898566, 126879289,
+    126915833, 126893411, 126892908, 126892311, 126904689, 126894597, 126902908, 126884444,
+    126896222, 126891778, 126909956, 126905978, 126896208, 126904386, 126908253, 126878953,
+    126895489, 126879800, 126875956, 126919378, 126896331, 126917733, 126900753, 126882375,
+    126913064, 126916011, 126920356, 126869453, 126921642, 126880686, 126924067, 126914122,
+    126894189, 126902622, 126901600, 126910000, 126903308, 126899467, 126876431, 126884753,
+    126923700, 126924019, 126914094, 126876478, 126923022, 126883700, 126879628, 126890089,
+    126881764, 126894331, 126877975, 126888742, 126930586, 126882753, 126899956, 126893511,
+    126913733, 126876811, 126894344, 126915008, 126918275, 126912489, 126937122, 126883219,
+    126896911, 126888642, 126911864, 126913267, 126886256, 126895197, 126894189, 126938219,
+    126933808, 126923633, 126936100, 126946553, 126922442, 126905497, 126952333, 126911275,
+    126952182, 126923800, 126904331, 126937500, 126931642, 126923133, 126923897, 126930031,
+    126941175, 126945153, 126947578, 126941378, 126934811, 126940619, 126917456, 126934500,
+    126953356, 126928133, 126935544, 126923064, 126919886, 126919867, 126932644, 126916797,
+    126937956, 126943578, 126911153, 126934222, 126946886, 126910564, 126949353, 126952264,
+    126903642, 126954589, 126909433, 126912697, 126954664, 126904197, 126918831, 126910408,
+    126907975, 126918842, 126908242, 126904222, 126901844, 126953844, 126941575, 126927075,
+    126934886, 126927975, 126931300, 126933389, 126929419, 126918080, 126942428, 126939875,
+    126941550, 126912108, 126948136, 126923478, 126911944, 126915553, 126937056, 126928444,
+    126907964, 126932963, 126907865, 126921651, 126936991, 126944400, 126951756, 126939386,
+    126923478, 126907344, 126909989, 126913375, 126909919, 126944086, 126953022, 126960667,
+    126959033, 126967375, 126895950, 126934156, 126936642, 126943733, 126922975, 126947719,
+    126952131, 126953578, 126936756, 126904244, 126910691, 126954222, 126907753, 126944811,
+    126956331, 126945586, 126907767, 126909305, 126899542, 126904311, 126958911, 126938897,
+    126931242, 126910531, 126938486, 126925911, 126937353, 126925131, 126946986, 126917842,
+    126913219, 126945956, 126915578, 126914833, 126951467, 126909222, 126928864, 126908978,
+    126924067, 126914386, 126951167, 126936844, 126911153, 126917278, 126910022, 126956844,
+    126929819, 126918789, 126921111, 126917889, 126922889, 126934189, 126912500, 126922678,
+    126943267, 126905944, 126919853, 126919400, 126912942, 126955422, 126941633, 126940978,
+    126972344, 126962108, 126959967, 126933022, 126934853, 126925178, 126936575, 126938200,
+    126934833, 126932778, 126935611, 126936831, 126927244, 126925219, 126926264, 126925442,
+    126925131, 126938919, 126952042, 126934075, 126930986, 126975197, 126959011, 126930800,
+    126956756, 126931811, 126976600, 126934631, 126964353, 126944378, 126957678, 126969608,
+    126959853, 126963056, 126955700, 126960431, 126947531, 126954444, 126942997, 126947489,
+    126963389, 126979086, 126961167, 126974656, 126991553, 126986478, 126986175, 126947056,
+    126966689, 126954400, 126995131, 126950522, 126954297, 126947222, 126957664, 126952542,
+    126998300, 127004642, 126986344, 126978578, 127001575, 127005464, 126956756, 126982644,
+    126985031, 126986308, 127011689, 126974075, 126996133, 126988097, 126973578, 126996886,
+    127003219, 127010056, 127007778, 126957088, 127012222, 126993375, 126996886, 126973578,
+    126997664, 127002622, 127009175, 127011819, 126961731, 126958911, 126996356, 126970389,
+    126977975, 126973642, 126960922, 126960342, 126983111, 126975775, 126998056, 126977333,
+    126970979, 126971533, 126966344, 126961567, 126979399, 126961465, 126968242, 126958486,
+    126989800, 126997531, 126994800, 127000667, 127004567, 126995889, 126989130, 126993322,
+    126990833, 126979508, 126996608, 126988133, 126987611, 126974086, 127002442, 127001133,
+    126973722, 126969108, 126996575, 126975733, 126979956, 127014567, 126960489, 127014467,
+    127007753, 126962611, 126967522, 126991844, 126997042, 126987564, 127002644, 126976967,
+    126980267, 127002333, 126971533, 126972042, 126968342, 126996778, 126975356, 126963397,
+    126981444, 127013463, 126959664, 127011086, 127010308, 126962089, 126966600, 127016789,
+    127016053, 126980008, 126981642, 126999642, 126986911, 126983978, 127002622, 126991067,
+    127006397, 127006086, 126970652, 126970956, 127009556, 126993431, 127007156, 127012964,
+    126966444, 126979108, 127017164, 126987889, 126964100, 127017664, 127007164, 126997711,
+    126961208, 127012711, 126961175, 127009933, 126968878, 127013242, 127016633, 127018742,
+    127008208, 127012767, 127006289, 127019297, 127014067, 126985833, 126987753, 126978844,
+    126994942, 127014933, 127021111, 127021331, 126999697, 126976078, 126997375, 127022353,
+    126976975, 126990678, 127000789, 126988567, 126986689, 127029933, 127021086, 127032164,
+    126990164, 127027611, 126983944, 126989597, 127003444, 127032319, 126995667, 127044189,
+    126998267, 127013356, 127024664, 127007344, 127015789, 127012000, 127019956, 127022653,
+    127035808, 127022197, 127004467, 127032278, 127005997, 127051886, 127027500, 127017753,
+    127011133, 127053822, 127015197, 127014475, 127039853, 127064467, 127050413, 127019800,
+    127054556, 127055400, 127059731, 127057922, 127062367, 127058097, 127037419, 127042733,
+    127054555, 127040464, 127065421, 127065531, 127041222, 127045178, 127038756, 127058710,
+    127016444, 127063611, 127048633, 127045153, 127036975, 127050789, 127042564, 127031778,
+    127049500, 127035422, 127058422, 127041853, 127023389, 127049338, 127059533, 127015131,
+    127014033, 127016275, 127058892, 127030522, 127037833, 127047631, 127018497, 127023667,
+    127031453, 127016133, 127014753, 127053411, 127034811, 127040497, 127048856, 127045400,
+    127038153, 127035144, 127053733, 127059556, 127063856, 127059853, 127026911, 127043144,
+    127021111, 127069019, 127048086, 127024222, 127057531, 127030511, 127049556, 127051986,
+    127056200, 127049300, 127046364, 127030713, 127057333, 127067253, 127035497, 127039289,
+    127025022, 127024475, 127075031, 127038078, 127073464, 127031533, 127023944, 127071708,
+    127020859, 127042142, 127039000, 127020333, 127049867, 127053864, 127047277, 127037784,
+    127037217, 127054222, 127057489, 127061575, 127058619, 127047564, 127024900, 127067819,
+    127023478, 127057433, 127069656, 127047956, 127025559, 127041689, 127033553, 127022056,
+    127068478, 127067631, 127022508, 127023497, 127032711, 127075308, 127023967, 127018464,
+    127028289, 127024167, 127021542, 127027719, 127048689, 127052997, 127040944, 127045008,
+    127058722, 127045856, 127029019, 127065089, 127035833, 127037767, 127031019, 127056708,
+    127070111, 127063519, 127071331, 127073752, 127025956, 127045997, 127025319, 127020511,
+    127036142, 127068713, 127074731, 127019853, 127030089, 127028178, 127029400, 127022042,
+    127049522, 127058389, 127048708, 127045511, 127053667, 127057211, 127037222, 127042767,
+    127065956, 127062367, 127040911, 127071486, 127030078, 127053667, 127070708, 127030544,
+    127041297, 127077467, 127069067, 127035842, 127045197, 127056344, 127050822, 127058919,
+    127044933, 127047819, 127046153, 127034419, 127060286, 127044433, 127049844, 127030622,
+    127060056, 127049900, 127068242, 127026642, 127070911, 127062653, 127055308, 127051111,
+    127046778, 127064664, 127068242, 127056633, 127063431, 127059208, 127069800, 127065431,
+    127077067, 127077997, 127031553, 127073267, 127082089, 127072842, 127082222, 127040667,
+    127073167, 127039122, 127088511, 127061448, 127097882, 127078253, 127072262, 127073797,
+    127089956, 127055089, 127088111, 127101111, 127064908, 127109075, 127100911, 127083889,
+    127089208, 127082042, 127065356, 127113322, 127113716, 127066986, 127108701, 127117578,
+    127114656, 127094753, 127082611, 127105319, 127097319, 127089453, 127084533, 127103462,
+    127088389, 127079028, 127092956, 127071759, 127079642, 127098946, 127110505, 127088519,
+    127072644, 127105225, 127111575, 127073931, 127074197, 127116789, 127106121, 127107386,
+    127089630, 127109019, 127082644, 127104942, 127076907, 127075700, 127073782, 127100097,
+    127088086, 127083308, 127083233, 127090897, 127121119, 127116511, 127125556, 127072718,
+    127097156, 127070128, 127075464, 127107052, 127111763, 127101153, 127113586, 127111544,
+    127111622, 127121633, 127117311, 127123031, 127114182, 127115922, 127128275, 127122942,
+    127121019, 127110840, 127103200, 127116388, 127123986, 127080367, 127129244, 127129419,
+    127127889, 127120131, 127106519, 127103642, 127128333, 127110233, 127130753, 127129289,
+    127107000, 127113064, 127107686, 127090131, 127088600, 127105753, 127094642, 127123911,
+    127118911, 127126200, 127111819, 127096411, 127109364, 127128642, 127086419, 127075742,
+    127073673, 127130244, 127079133, 127126011, 127084533, 127125864, 127107931, 127099689,
+    127105308, 127118864, 127087867, 127124244, 127092108, 127086600, 127122908, 127084419,
+    127110056, 127102653, 127126031, 127131586, 127131967, 127116533, 127089975, 127129353,
+    127082644, 127077997, 127131864, 127100267, 127090219, 127089086, 127089678, 127087622,
+    127085389, 127081722, 127108464, 127089353, 127081133, 127089289, 127082253, 127077022,
+    127082778, 127129886, 127083544, 127082164, 127094778, 127118375, 127085442, 127101553,
+    127096275, 127121868, 127080586, 127082456, 127078144, 127120544, 127080089, 127079664,
+    127108061, 127086765, 127092178, 127111708, 127098889, 127094324, 127090121, 127109067,
+    127127197, 127087442, 127089642, 127133333, 127097956, 127131233, 127134386, 127123619,
+    127137697, 127140678, 127139631, 127149108, 127099167, 127143342, 127104444, 127157678,
+    127123022, 127136667, 127124444, 127142556, 127124000, 127116419, 127132122, 127121697,
+    127136944, 127150708, 127112386, 127111053, 127136419, 127149597, 127121919, 127133531,
+    127133110, 127142711, 127117578, 127148333, 127122778, 127118422, 127126911, 127150186,
+    127158775, 127160442, 127112386, 127154331, 127108356, 127122042, 127158411, 127151756,
+    127122942, 127142197, 127161019, 127130186, 127143242, 127132400, 127143764, 127121119,
+    127121500, 127123953, 127134778, 127154963, 127139386, 127122131, 127143389, 127122367,
+    127158253, 127120822, 127152467, 127154697, 127144042, 127160244, 127141553, 127162975,
+    127132622, 127154256, 127145064, 127165000, 127125286, 127159711, 127121264, 127122367,
+    127152235, 127137920, 127139486, 127157197, 127152664, 127136467, 127173889, 127133071,
+    127131642, 127152697, 127138394, 127165853, 127143111, 127129433, 127128359, 127128359,
+    127147386, 127167275, 127158843, 127133200, 127140022, 127153642, 127132319, 127136667,
+    127147719, 127139419, 127164533, 127160400, 127157472, 127166133, 127167500, 127157419,
+    127151086, 127166419, 127152253, 127170997, 127147889, 127163111, 127143275, 127143464,
+    127168789, 127141111, 127140800, 127148464, 127135022, 127133531, 127152089, 127152502,
+    127149000, 127150678, 127145408, 127141492, 127149655, 127134533, 127172908, 127153444,
+    127144019, 127146168, 127163878, 127168300, 127148022, 127175900, 127138878, 127138831,
+    127158329, 127134886, 127185065, 127140375, 127134764, 127136500, 127180400, 127151289,
+    127143086, 127166486, 127185914, 127142156, 127136378, 127151019, 127170597, 127161044,
+    127189278, 127141500, 127146722, 127137108, 127181553, 127191967, 127140708, 127161331,
+    127188431, 127191222, 127179886, 127140556, 127170775, 127153931, 127189108, 127174542,
+    127174542, 127206242, 127189522, 127159331, 127165700, 127203422, 127180400, 127212753,
+    127169133, 127163397, 127161656, 127164378, 127207197, 127205531, 127202767, 127205601,
+    127195513, 127201189, 127223519, 127217408, 127239975, 127196675, 127198300, 127203844,
+    127221467, 127207442, 127213822, 127232942, 127188142, 127228593, 127244597, 127227479,
+    127227622, 127243887, 127247022, 127217000, 127216133, 127211722, 127208864, 127202697,
+    127226189, 127200253, 127196200, 127213308, 127196067, 127218633, 127207889, 127238178,
+    127251133, 127206667, 127230700, 127202419, 127219597, 127202244, 127228633, 127245678,
+    127253253, 127214886, 127210333, 127244075, 127249744, 127237178, 127256222, 127213797,
+    127229886, 127210653, 127244364, 127226019, 127235400, 127254753, 127234800, 127266975,
+    127274900, 127250931, 127242042, 127242188, 127251533, 127252333, 127254625, 127256899,
+    127279530, 127264306, 127280350, 127262397, 127248222, 127247612, 127268085, 127256708,
+    127236841, 127247913, 127273774, 127271622, 127264162, 127239019, 127283064, 127236864,
+    127275356, 127261389, 127272197, 127281844, 127259875, 127293086, 127276397, 127265464,
+    127281953, 127257786, 127269120, 127290833, 127259467, 127254642, 127255924, 127304000,
+    127305544, 127310833, 127290178, 127277664, 127315733, 127310431, 127287056, 127282442,
+    127275775, 127286256, 127279467, 127265956, 127302033, 127294108, 127298444, 127316111,
+    127306019, 127276511, 127284753, 127281344, 127325597, 127272908, 127298856, 127279508,
+    127318600, 127337222, 127339400, 127308730, 127334691, 127341111, 127307896, 127313911,
+    127320556, 127339042, 127289069, 127289069, 127301191, 127290412, 127310678, 127326866,
+    127326722, 127298399, 127304731, 127346444, 127319753, 127315122, 127360233, 127333333,
+    127346200, 127309142, 127328153, 127350808, 127328233, 127355400, 127358864, 127319344,
+    127369344, 127314033, 127319508, 127342678, 127361975, 127341900, 127336067, 127343844,
+    127348356, 127321389, 127343464, 127373642, 127339256, 127323667, 127371864, 127327300,
+    127377489, 127354208, 127362611, 127359656, 127329000, 127335219, 127372922, 127362808,
+    127372400, 127343764, 127368864, 127375978, 127351411, 127388219, 127386567, 127385775,
+    127379508, 127384142, 127377022, 127387353, 127388889, 127369975, 127346732, 127359731,
+    127396389, 127383186, 127375708, 127385653, 127387942, 127343296, 127395000, 127397264,
+    127397367, 127358342, 127377131, 127376233, 127349533, 127369000, 127385922, 127370376,
+    127359419, 127359419, 127377753, 127378953, 127376953, 127377556, 127406175, 127412786,
+    127426344, 127417942, 127423611, 127408722, 127381586, 127391919, 127382622, 127392500,
+    127402197, 127385097, 127386667, 127382908, 127382344, 127404486, 127398397, 127400000,
+    127426967, 127425300, 127430719, 127427800, 127438844, 127400442, 127444533, 127401344,
+    127423111, 127434853, 127417686, 127431100, 127420400, 127414622, 127422199, 127437938,
+    127425456, 127428031, 127412426, 127412475, 127437436, 127426975, 127447867, 127443578,
+    127405922, 127451242, 127440056, 127435822, 127443864, 127411975, 127449508, 127399167,
+    127408642, 127401331, 127452022, 127423600, 127428897, 127432908, 127413464, 127442033,
+    127428553, 127434411, 127402531, 127400001, 127388777, 127429075, 127427875, 127414331,
+    127426242, 127431208, 127435842, 127450089, 127427833, 127435097, 127445956, 127430422,
+    127434731, 127459956, 127461567, 127460944, 127456689, 127439556, 127437644, 127443411,
+    127430611, 127437800, 127424508, 127427022, 127443219, 127454753, 127443242, 127442733,
+    127444100, 127445111, 127458267, 127473300, 127461153, 127469364, 127458056, 127454175,
+    127457311, 127429142, 127464933, 127465219, 127432278, 127442075, 127441533, 127444067,
+    127460064, 127478333, 127489231, 127490308, 127492631, 127455911, 127478178, 127469975,
+    127494731, 127463600, 127459508, 127459853, 127498356, 127511731, 127490686, 127480686,
+    127503411, 127482108, 127500997, 127474197, 127510164, 127501444, 127478978, 127475842,
+    127511731, 127493586, 127487664, 127483289, 127494289, 127484853, 127487664, 127492531,
+    127478797, 127490319, 127483289, 127493531, 127498967, 127505719, 127483308, 127511397,
+    127485489, 127497222, 127479264, 127524011, 127482286, 127494500, 127488889, 127492908,
+    127535431, 127489886, 127496067, 127487644, 127496819, 127518689, 127511778, 127525544,
+    127540111, 127493708, 127489331, 127507333, 127499175, 127522942, 127499311, 127488578,
+    127488889, 127486086, 127484919, 127490111, 127534556, 127481289, 127485911, 127490431,
+    127528364, 127491200, 127489508, 127531053, 127545986, 127523300, 127521819, 127534608,
+    127554942, 127522244, 127557189, 127506675, 127548219, 127529867, 127529575, 127536622,
+    127551011, 127544400, 127537778, 127528531, 127564900, 127548544, 127547244, 127573488,
+    127543708, 127588675, 127538953, 127597889, 127601911, 127552400, 127580789, 127539844,
+    127583200, 127583342, 127545922, 127602286, 127579867, 127591019, 127570064, 127560922,
+    127621622, 127573633, 127622522, 127577089, 127581308, 127598667, 127606189, 127583289,
+    127583708, 127615064, 127600286, 127608978, 127618953, 127645667, 127639622, 127628975,
+    127642022, 127644311, 127641444, 127648308, 127642964, 127670022, 127656633, 127635611,
+    127615678, 127634664, 127621397, 127627578, 127625367, 127615031, 127637786, 127614622,
+    127655178, 127661575, 127662867, 127664411, 127671222, 127664075, 127674967, 127666222,
+    127660556, 127641797, 127650856, 127651011, 127692622, 127692778, 127664731, 127681142,
+    127675097, 127712922, 127666233, 127718167, 127722419, 127695042, 127714475, 127710356,
+    127709278, 127641511, 127664386, 127663797, 127667589, 127675897, 127665197, 127696756,
+    127689297, 127698178, 127680497, 127699811, 127701067, 127693219, 127665197, 127684289,
+    127697556, 127688056, 127687067, 127723464, 127729811, 127731608, 127719053, 127700911,
+    127734764, 127739486, 127747067, 127738700, 127756344, 127755022, 127752653, 127713667,
+    127757000, 127769811, 127763308, 127744467, 127728308, 127738511, 127729819, 127731975,
+    127732311, 127750619, 127752686, 127755997, 127738322, 127743578, 127730122, 127732442,
+    127726575, 127783444, 127726919, 127748364, 127754019, 127723831, 127721419, 127713978,
+    127723431, 127728044, 127738178, 127745022, 127749508, 127706533, 127731011, 127729222,
+    127746633, 127710686, 127704956, 127711886, 127724156, 127725319, 127751819, 127721819,
+    127760244, 127753431, 127747419, 127711086, 127727419, 127752375, 127728797, 127776389,
+    127769297, 127753111, 127785611, 127778119, 127761986, 127794086, 127798111, 127790897,
+    127787197, 127788831, 127793078, 127759731, 127797733, 127819433, 127798422, 127792178,
+    127768708, 127792375, 127779067, 127816111, 127802164, 127794500, 127789908, 127813444,
+    127835308, 127821389, 127791708, 127831656, 127822644, 127812489, 127866189, 127856378,
+    127820122, 127859189, 127849975, 127842433, 127852711, 127890842, 127855319, 127890922,
+    127888167, 127856242, 127840464, 127861133, 127847908, 127819444, 127842842, 127833931,
+    127875619, 127865333, 127879622, 127864133, 127835064, 127856797, 127873586, 127846689,
+    127907686, 127877108, 127928144, 127918456, 127921233, 127927622, 127903289, 127931297,
+    127919189, 127926633, 127917264, 127887008, 127923375, 127922056, 127928775, 127936697,
+    127942231, 127927900, 127937319, 127951722, 127888931, 127894467, 127895956, 127876467,
+    127916175, 127903111, 127894989, 127881697, 127934289, 127929989, 127927300, 127912189,
+    127911656, 127906019, 127945789, 127915278, 127919956, 127957278, 127916397, 127934331,
+    127912686, 127961553, 127962244, 127956264, 127953578, 127919400, 127957386, 127966600,
+    127940964, 127937467, 127936222, 127934811, 127940875, 127936175, 127965333, 127960319,
+    127957908, 127986044, 127955511, 127962531, 127959175, 127973742, 127949000, 127957489,
+    127946111, 127949664, 127944331, 127946378, 127954222, 127987222, 127994811, 127963931,
+    127969100, 127992244, 127992819, 127956900, 127979075, 127961819, 127943756, 127963022,
+    127975253, 127959811, 127995464, 127971011, 128000875, 128005897, 128002833, 127997000,
+    128028022, 128014108, 128004589, 128021264, 128032384, 128045800, 127987800, 128003144,
+    128014319, 128040020, 128042542, 128047264, 128008978, 128035842, 128016756, 128044053,
+    128016900, 128037400, 128028844, 128049919, 128062400, 128024353, 128069222, 128073756,
+    128064244, 128083978, 128081697, 128064656, 128112400, 128089108, 128085611, 128139378,
+    128049067, 128081864, 128074311, 128071308, 128080856, 128066778, 128063444, 128065422,
+    128077408, 128093356, 128090611, 128071200, 128069622, 128084786, 128054467, 128063953,
+    128088422, 128075111, 128088586, 128078257, 128115556, 128101264, 128127678, 128126175,
+    128115800, 128109541, 128119867, 128091453, 128127875, 128120889, 128094597, 128132800,
+    128091586, 128110319, 128147753, 128118856, 128109222, 128123878, 128127631, 128158308,
+    128152597, 128172697, 128174400, 128125078, 128095633, 128126111, 128104975, 128110000,
+    128135843, 128129575, 128111222, 128111758, 128108822, 128150111, 128117178, 128117578,
+    128110456, 128123953, 128147644, 128115597, 128167931, 128160153, 128169908, 128141642,
+    128166184, 128175782, 128174508, 128181725, 128146708, 128188422, 128183356, 128161264,
+    128171944, 128171308, 128166500, 128162164, 128154800, 128160008, 128160800, 128181642,
+    128189019, 128189919, 128198267, 128199975, 128172500, 128183233, 128166600, 128170375,
+    128170822, 128193153, 128202744, 128210225, 128201799, 128216608, 128217686, 128217033,
+    128215117, 128213356, 128221011, 128188397, 128206411, 128210767, 128194642, 128188567,
+    128207678, 128190022, 128166511, 128171575, 128213011, 128194778, 128176708, 128220197,
+    128235178, 128192362, 128228743, 128216406, 128191689, 128199664, 128250408, 128210800,
+    128238186, 128208642, 128260956, 128261608, 128208064, 128223254, 128263208, 128270842,
+    128271133, 128262222, 128284908, 128222089, 128261078, 128239853, 128225544, 128271844,
+    128263822, 128262719, 128247467, 128251142, 128268389, 128280864, 128267531, 128284353,
+    128244067, 128265022, 128267903, 128282992, 128289613, 128263336, 128255678, 128301175,
+    128280956, 128273756, 128301242, 128279631, 128317178, 128325653, 128295122, 128305611,
+    128328387, 128321500, 128265578, 128276053, 128300556, 128279278, 128272711, 128292819,
+    128328553, 128315842, 128326778, 128323978, 128344175, 128292597, 128336828, 128315760,
+    128345153, 128337800, 128360111, 128346778, 128334689, 128340800, 128339419, 128348056,
+    128336667, 128349622, 128351986, 128332964, 128355719, 128368708, 128354344, 128367842,
+    128370356, 128387644, 128361019, 128392353, 128399508, 128396486, 128381778, 128391975,
+    128429844, 128364156, 128324542, 128326533, 128337097, 128338911, 128375522, 128328553,
+    128347231, 128357597, 128388267, 128379433, 128390031, 128361467, 128352400, 128362075,
+    128351736, 128403797, 128384967, 128399900, 128365997, 128411378, 128371478, 128386675,
+    128368267, 128383078, 128367975, 128361467, 128393742, 128383831, 128407022, 128392564,
+    128392311, 128413186, 128418850, 128406697, 128457433, 128460319, 128442419, 128470164,
+    128469197, 128454753, 128397908, 128415789, 128421953, 128400532, 128416756, 128409208,
+    128406467, 128423200, 128418987, 128436708, 128408708, 128410442, 128425922, 128426478,
+    128433708, 128413333, 128415667, 128449786, 128433275, 128422556, 128456533, 128456175,
+    128447711, 128422856, 128420856, 128427833, 128436356, 128477622, 128434867, 128442419,
+    128463944, 128470556, 128455022, 128455822, 128443114, 128489597, 128464019, 128468364,
+    128498044, 128527867, 128435278, 128432433, 128434642, 128429197, 128444589, 128427686,
+    128467412, 128500286, 128479433, 128475144, 128494533, 128503356, 128470064, 128496189,
+    128474278, 128459773, 128503056, 128514013, 128465978, 128503097, 128501044, 128512800,
+    128493300, 128497442, 128492467, 128504731, 128508742, 128505832, 128513167, 128528675,
+    128527333, 128527156, 128558864, 128555400, 128587653, 128609800, 128559297, 128594167,
+    128584819, 128590442, 128578464, 128597942, 128593200, 128597931, 128590475, 128560978,
+    128509900, 128507311, 128524475, 128488325, 128507625, 128518564, 128523856, 128520253,
+    128530153, 128515244, 128513186, 128552419, 128547197, 128538519, 128534400, 128526675,
+    128525178, 128561411, 128535064, 128544378, 128549565, 128557644, 128542000, 128553808,
+    128539853, 128533544, 128562964, 128546478, 128532178, 128558889, 128543289, 128562653,
+    128547819, 128574556, 128525153, 128571189, 128550956, 128568044, 128555619, 128565964,
+    128530497, 128576689, 128576297, 128544378, 128555742, 128571844, 128550333, 128571242,
+    128576622, 128563519, 128565489, 128571331, 128576975, 128553078, 128549631, 128557733,
+    128571642, 128575440, 128545800, 128551011, 128555733, 128541078, 128587678, 128571019,
+    128575078, 128578553, 128586444, 128574264, 128580875, 128614067, 128577286, 128621667,
+    128570112, 128621356, 128643267, 128626297, 128592611, 128580887, 128572050, 128577012,
+    128567863, 128579706, 128578600, 128579128, 128585990, 128565446, 128574247, 128566238,
+    128564137, 128569238, 128564137, 128602463, 128558175, 128557750, 128583989, 128593525,
+    128586195, 128598388, 128586212, 128583925, 128573350, 128561637, 128607038, 128571289,
+    128605131, 128620556, 128591467, 128617311, 128624689, 128630253, 128603553, 128599800,
+    128608397, 128632867, 128601667, 128600111, 128603289, 128612900, 128601953, 128617222,
+    128600464, 128606575, 128621344, 128592644, 128588878, 128589989, 128624278, 128611167,
+    128618864, 128587197, 128591756, 128620089, 128600356, 128627442, 128581322, 128617622,
+    128582719, 128592622, 128616797, 128581397, 128579122, 128633531, 128622808, 128587942,
+    128579444, 128572198, 128631486, 128585022, 128610497, 128606419, 128611486, 128596911,
+    128620753, 128605830, 128599175, 128591553, 128618553, 128627664, 128602108, 128616533,
+    128583389, 128625375, 128631511, 128635244, 128585822, 128629400, 128609131, 128625897,
+    128576212, 128599400, 128632697, 128626344, 128632131, 128658497, 128629886, 128632578,
+    128631697, 128624011, 128621031, 128620197, 128622189, 128656364, 128680486, 128644364,
+    128663086, 128663931, 128672697, 128708431, 128725319, 128612333, 128610375, 128623356,
+    128623325, 128609467, 128637944, 128627162, 128640154, 128640234, 128622950, 128612324,
+    128653742, 128626697, 128661200, 128672889, 128648186, 128645678, 128639353, 128652719,
+    128649419, 128643478, 128640422, 128637711, 128651900, 128667475, 128684331, 128655986,
+    128647467, 128640456, 128641622, 128649108, 128640422, 128689264, 128646467, 128666453,
+    128697197, 128664042, 128683308, 128699364, 128697056, 128676444, 128661864, 128692264,
+    128698531, 128716731, 128715375, 128704000, 128715964, 128719731, 128666111, 128704508,
+    128678086, 128734875, 128738022, 128742875, 128720552, 128761608, 128694886, 128690556,
+    128694364, 128646287, 128658775, 128684575, 128657578, 128710081, 128689563, 128686838,
+    128700033, 128699912, 128677376, 128705436, 128703744, 128707313, 128660315, 128660338,
+    128702940, 128700594, 128695020, 128687212, 128708712, 128694167, 128684129, 128667345,
+    128669512, 128673695, 128682513, 128707781, 128713289, 128675153, 128732108, 128736200,
+    128708444, 128729108, 128730089, 128741431, 128742664, 128743464, 128708911, 128714642,
+    128728333, 128697344, 128736200, 128704331, 128710977, 128711046, 128722430, 128717408,
+    128726944, 128770253, 128772131, 128751886, 128721953, 128731622, 128737131, 128731933,
+    128768764, 128775956, 128757419, 128741878, 128787914, 128829311, 128705333, 128736911,
+    128729400, 128749633, 128749989, 128735556, 128755842, 128766778, 128755278, 128756356,
+    128748486, 128748944, 128759386, 128765544, 128743531, 128756467, 128762108, 128748797,
+    128792022, 128791486, 128814011, 128790111, 128812300, 128833133, 128835578, 128820308,
+    128829197, 128824075, 128845511, 128854400, 128840219, 128878497, 128883253, 128882386,
+    128834433, 128885931, 128882889, 128880308, 128851086, 128839197, 128814033, 128814835,
+    128782692, 128797786, 128812772, 128811325, 128832908, 128804508, 128840000, 128817097,
+    128839622, 128824844, 128818553, 128821419, 128838775, 128825286, 128854575, 128887419,
+    128902400, 128879189, 128905612, 128915667, 128929811, 128910578, 128915944, 128918233,
+    128902000, 128905367, 128897300, 128860808, 128879107, 128873242, 128866722, 128869753,
+    128880556, 128885733, 128888822, 128851667, 128878289, 128883111, 128857867, 128894886,
+    128878111, 128897022, 128879811, 128891356, 128921697, 128898233, 128896764, 128919886,
+    128917156, 128962686, 128945308, 128956511, 128926502, 128899758, 128904075, 128937508,
+    128891667, 128909642, 128902108, 128928986, 128932697, 128921067, 128915464, 128940775,
+    128944731, 128941797, 128932042, 128934933, 128923789, 128976297, 128962222, 128964100,
+    129005408, 129010475, 129024467, 128987997, 128993911, 128988953, 128980153, 128992942,
+    129040253, 128973578, 128984433, 128974844, 128969142, 128990042, 128977042, 128966533,
+    128978931, 128962686, 128961633, 128985400, 128976575, 128991622, 128993333, 128981708,
+    128989678, 128989444, 128985531, 128974444, 128992475, 128982908, 128989689, 128982856,
+    128979967, 128958700, 129000244, 128998333, 128985178, 128982475, 128990644, 129011397,
+    129020442, 129019133, 129059400, 129059019, 129040111, 129049019, 129064522, 129067489,
+    129042108, 129047475, 129085389, 129070667, 129102531, 129107197, 129110197, 129106811,
+    129023600, 129026378, 129034508, 129027622, 129020753, 129028797, 129022508, 129023897,
+    129033333, 129017686, 129032753, 129022564, 129025431, 129016675, 129036878, 129034086,
+    129034033, 129037589, 129019508, 129025564, 129037286, 129014189, 129011600, 129006275,
+    129039189, 129014833, 129040800, 129039853, 129021864, 129000422, 129046622, 129048397,
+    129006911, 129042067, 129047033, 129043642, 129036744, 129044533, 129047456, 129055319,
+    129024175, 129031289, 129024222, 129021689, 129012733, 129044053, 129042367, 129003722,
+    129038797, 129050278, 129044689, 129000144, 129042056, 129051778, 129042964, 129047264,
+    129011044, 129031397, 129019697, 129039467, 129019019, 129038519, 129010244, 129003411,
+    129049833, 129055008, 129022022, 129015089, 129012333, 129012467, 129058342, 129039411,
+    129032211, 129028422, 129043253, 129042956, 129066667, 129049575, 129054867, 129048111,
+    129098022, 129065611, 129092631, 129114622, 129116486, 129114786, 129165244, 129130931,
+    129127375, 129111167, 129116633, 129117564, 129118444, 129082922, 129070708, 129070186,
+    129082889, 129068031, 129060686, 129070922, 129097456, 129086778, 129086500, 129059175,
+    129073578, 129070997, 129069622, 129073919, 129092489, 129085842, 129071200, 129063300,
+    129095719, 129068444, 129059075, 129058397, 129093619, 129075851, 129102578, 129060922,
+    129061986, 129058308, 129052792, 129056019, 129076953, 129085856, 129082075, 129083022,
+    129093389, 129087156, 129093844, 129078356, 129088375, 129072542, 129071722, 129075308,
+    129100911, 129081575, 129087942, 129075253, 129103333, 129068553, 129064344, 129107197,
+    129070022, 129106500, 129104656, 129077989, 129059167, 129112311, 129096511, 129103242,
+    129066656, 129106933, 129109731, 129094319, 129087211, 129089231, 129096133, 129095000,
+    129084378, 129092889, 129094400, 129090875, 129082386, 129101397, 129081561, 129113375,
+    129092056, 129094622, 129115597, 129064142, 129089222, 129106515, 129128044, 129093464,
+    129104697, 129161667, 129126944, 129131031, 129207531, 129166444, 129167489, 129186886,
+    129170808, 129166933, 129115686, 129112664, 129115064, 129111297, 129115375, 129165808,
+    129127678, 129142402, 129116986, 129114867, 129112597, 129113667, 129160286, 129114731,
+    129166478, 129115856, 129132353, 129135700, 129127719, 129125644, 129121189, 129142211,
+    129119344, 129117542, 129118289, 129150008, 129162697, 129152022, 129152264, 129150956,
+    129156200, 129175422, 129159156, 129161200, 129190544, 129168600, 129204900, 129247186,
+    129228111, 129182108, 129205897, 129178478, 129184919, 129176553, 129168986, 129224475,
+    129218178, 129182678, 129211844, 129232419, 129203531, 129202475, 129222022, 129217056,
+    129212867, 129208553, 129224989, 129209642, 129227022, 129225464, 129220753, 129204697,
+    129229444, 129212556, 129265244, 129284197, 129232283, 129246289, 129283056, 129297164,
+    129277989, 129268275, 129263011, 129296167, 129302833, 129289833, 129273431, 129275544,
+    129305586, 129347678, 129375400, 129338011, 129328567, 129316864, 129337500, 129320667,
+    129341275, 129329122, 129306002, 129316778, 129313689, 129332386, 129334875, 129336986,
+    129324050, 129323722, 129334156, 129314642, 129318722, 129343911, 129343097, 129334252,
+    129306731, 129318844, 129308844, 129339542, 129310178, 129348856, 129348275, 129309697,
+    129350475, 129341933, 129358333, 129327367, 129362244, 129361667, 129356963, 129345333,
+    129352686, 129333178, 129346419, 129371447, 129377833, 129367908, 129363944, 129359908,
+    129366289, 129382353, 129364062, 129381364, 129344042, 129339833, 129359231, 129374853,
+    129380986, 129368356, 129375131, 129350686, 129382211, 129402786, 129396819, 129405400,
+    129424575, 129401397, 129387808, 129363544, 129359811, 129363397, 129417033, 129407997,
+    129399419, 129400244, 129416600, 129409467, 129412975, 129441731, 129443708, 129453733,
+    129418953, 129431575, 129428544, 129426864, 129420644, 129430875, 129426411, 129433889,
+    129433633, 129423133, 129450653, 129462664, 129445408, 129442542, 129503889, 129494919,
+    129548531, 129555531, 130836189, 130903789, 130901756, 130872753, 131864847,
+};
+
+constexpr uint8_t locationSoaGridX[] PROGMEM = {
+    21, 21, 28, 28, 33, 38, 42, 42, 43, 44, 44, 44, 45, 45, 45, 45,
+    45, 46, 46, 46, 46, 46, 46, 46, 46, 47, 47, 47, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+    69, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+    70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+    73, 73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 77, 77, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+    80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+    82, 82, 82, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+    83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+    83, 83, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+    85, 85, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+    93, 93, 93, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+    94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+    95, 95, 95, 95, 95, 95, 95, 95, 95, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    102, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 105, 105,
+    105, 106, 126, 127, 127, 127, 144,
+};
+
+constexpr uint8_t locationSoaGridY[] PROGMEM = {
+    132, 135, 8, 8, 64, 129, 64, 65, 95, 55, 62, 68, 62, 65, 67, 73,
+    75, 35, 58, 58, 63, 66, 71, 109, 119, 72, 108, 128, 32, 36, 48, 58,
+    59, 59, 60, 73, 84, 107, 109, 109, 110, 111, 120, 131, 32, 37, 60, 62,
+    64, 68, 70, 104, 110, 130, 32, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 67, 67, 67, 67, 67, 67, 67, 71, 71, 75, 102, 108, 109,
+    124, 126, 128, 129, 130, 131, 132, 32, 38, 38, 61, 63, 65, 66, 66, 67,
+    67, 67, 67, 67, 67, 69, 74, 76, 77, 79, 79, 109, 109, 110, 110, 110,
+    110, 111, 111, 113, 120, 125, 128, 129, 130, 130, 131, 131, 32, 32, 38, 38,
+    38, 38, 38, 38, 38, 57, 60, 67, 69, 71, 71, 71, 72, 72, 74, 75,
+    76, 77, 77, 79, 80, 85, 99, 102, 103, 105, 107, 110, 112, 125, 32, 32,
+    32, 32, 33, 33, 33, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 53,
+    53, 59, 62, 64, 65, 69, 71, 72, 76, 77, 80, 81, 82, 96, 100, 100,
+    101, 102, 102, 104, 104, 106, 108, 110, 112, 113, 114, 120, 124, 125, 125, 128,
+    129, 130, 33, 33, 38, 38, 58, 60, 61, 61, 65, 68, 70, 71, 72, 73,
+    75, 75, 78, 80, 84, 91, 96, 97, 98, 99, 100, 100, 100, 100, 104, 105,
+    112, 112, 112, 112, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124,
+    124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 127, 127, 127, 128,
+    128, 129, 130, 39, 53, 57, 59, 61, 63, 66, 67, 68, 69, 70, 74, 76,
+    76, 79, 80, 82, 84, 84, 86, 86, 87, 91, 92, 92, 92, 92, 92, 92,
+    92, 93, 94, 94, 94, 95, 96, 97, 99, 101, 104, 105, 106, 106, 107, 107,
+    108, 109, 110, 111, 112, 113, 118, 121, 123, 123, 123, 123, 123, 123, 123, 123,
+    123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+    124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128,
+    128, 129, 129, 130, 130, 132, 133, 33, 60, 61, 64, 66, 66, 67, 68, 69,
+    71, 71, 71, 71, 71, 71, 72, 72, 75, 76, 77, 80, 80, 81, 82, 83,
+    85, 87, 87, 87, 87, 89, 91, 91, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 94, 95, 96, 97, 97, 102, 106, 107, 108, 109, 110, 112, 119, 119,
+    122, 122, 122, 122, 122, 122, 122, 123, 123, 124, 124, 124, 124, 124, 124, 124,
+    124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 127, 127, 127, 128, 128, 128, 129, 129, 129, 129, 129,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 131, 131,
+    131, 131, 131, 133, 56, 56, 60, 61, 63, 63, 64, 65, 70, 71, 71, 72,
+    73, 73, 74, 74, 74, 74, 74, 74, 74, 75, 75, 75, 77, 77, 77, 78,
+    79, 80, 82, 83, 84, 85, 86, 88, 89, 90, 91, 92, 92, 93, 94, 95,
+    97, 97, 98, 99, 101, 102, 103, 104, 105, 106, 108, 109, 110, 116, 116, 119,
+    119, 121, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+    122, 123, 123, 123, 123, 123, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129,
+    130, 130, 132, 132, 134, 34, 56, 58, 59, 63, 65, 66, 70, 72, 73, 73,
+    74, 74, 74, 74, 74, 74, 75, 75, 75, 75, 75, 75, 75, 76, 76, 76,
+    76, 77, 83, 83, 83, 83, 83, 83, 83, 83, 84, 84, 85, 87, 89, 90,
+    92, 92, 93, 94, 99, 102, 104, 106, 107, 107, 109, 110, 111, 114, 119, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 122, 122, 122, 123, 123, 123, 123, 124,
+    124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 127, 127, 127, 127, 127, 127, 128, 128, 128, 129, 129, 129, 129, 131,
+    133, 136, 38, 53, 58, 60, 62, 64, 64, 65, 69, 71, 73, 73, 73, 73,
+    73, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 76, 76, 77,
+    80, 84, 85, 86, 86, 88, 88, 88, 88, 88, 89, 90, 91, 94, 95, 96,
+    97, 98, 99, 99, 99, 100, 107, 110, 114, 114, 115, 116, 117, 118, 119, 120,
+    120, 121, 121, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123,
+    123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+    123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    128, 128, 128, 128, 128, 128, 128, 128, 130, 130, 135, 137, 37, 38, 59, 61,
+    68, 70, 71, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 75, 75, 75, 75, 76, 77, 77, 78, 80, 85, 85, 87, 88, 89, 90,
+    91, 91, 91, 91, 91, 91, 91, 91, 92, 92, 92, 92, 92, 92, 93, 93,
+    94, 95, 95, 96, 100, 102, 104, 105, 109, 110, 110, 110, 110, 110, 111, 115,
+    118, 119, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122, 123, 123, 123, 123,
+    123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 132, 132, 134,
+    137, 137, 138, 139, 56, 63, 65, 65, 66, 68, 70, 72, 72, 75, 76, 77,
+    78, 78, 78, 79, 82, 83, 84, 84, 86, 88, 89, 90, 92, 94, 96, 96,
+    97, 98, 98, 100, 102, 103, 104, 109, 109, 110, 110, 111, 113, 114, 115, 115,
+    116, 116, 116, 116, 116, 116, 117, 117, 118, 118, 118, 118, 119, 119, 119, 119,
+    119, 119, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    120, 120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 124, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 129, 129, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 131, 131,
+    131, 132, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 135, 136, 137,
+    138, 138, 57, 58, 66, 66, 66, 71, 73, 76, 78, 89, 89, 90, 90, 91,
+    92, 92, 94, 95, 96, 96, 97, 97, 97, 98, 101, 108, 110, 110, 110, 110,
+    114, 114, 114, 114, 114, 114, 114, 115, 115, 117, 117, 117, 118, 118, 118, 118,
+    118, 119, 119, 119, 119, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 122, 122, 122, 122, 122,
+    122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 123, 123,
+    123, 123, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129,
+    130, 130, 130, 131, 132, 132, 133, 140, 59, 64, 66, 69, 71, 72, 75, 76,
+    77, 78, 79, 79, 79, 80, 81, 85, 87, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 90, 90, 90, 90, 93, 96, 97, 99, 99, 100, 102,
+    102, 102, 103, 103, 103, 103, 104, 106, 108, 108, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 112, 112, 113, 114, 114,
+    115, 117, 118, 120, 120, 120, 120, 120, 121, 122, 122, 122, 123, 123, 123, 123,
+    124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+    124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 125, 125, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127,
+    127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 129, 130, 132, 133,
+    133, 136, 61, 61, 66, 67, 68, 69, 76, 77, 79, 82, 82, 83, 86, 88,
+    89, 89, 89, 91, 92, 93, 97, 104, 108, 112, 113, 114, 115, 116, 117, 119,
+    119, 119, 120, 120, 120, 122, 122, 123, 123, 124, 124, 126, 126, 126, 126, 126,
+    126, 126, 126, 127, 127, 128, 128, 128, 129, 130, 131, 134, 134, 134, 135, 136,
+    140, 141, 141, 62, 67, 73, 74, 76, 78, 80, 81, 85, 90, 93, 96, 97,
+    98, 99, 99, 99, 99, 101, 103, 103, 103, 103, 103, 104, 104, 104, 104, 104,
+    104, 104, 105, 106, 107, 109, 109, 110, 111, 113, 114, 115, 115, 115, 115, 116,
+    120, 123, 123, 123, 123, 123, 124, 125, 126, 129, 134, 138, 139, 139, 62, 62,
+    63, 66, 69, 70, 74, 77, 77, 77, 79, 82, 84, 84, 86, 86, 91, 95,
+    99, 99, 99, 100, 100, 100, 101, 101, 101, 101, 103, 103, 103, 103, 104, 105,
+    106, 106, 109, 110, 114, 118, 120, 121, 122, 125, 126, 128, 130, 132, 132, 135,
+    137, 50, 60, 62, 64, 65, 66, 68, 69, 74, 77, 78, 79, 79, 80, 80,
+    80, 82, 82, 83, 83, 85, 87, 89, 96, 98, 99, 99, 99, 99, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 101, 101, 101, 101, 101, 102, 104, 106, 106, 107, 112, 116, 118, 121, 125,
+    131, 140, 142, 143, 63, 71, 73, 80, 80, 80, 80, 80, 80, 82, 84, 86,
+    88, 88, 90, 92, 94, 96, 99, 99, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+    100, 100, 100, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 102, 102, 102,
+    103, 103, 105, 106, 106, 106, 106, 107, 107, 107, 107, 107, 109, 110, 111, 111,
+    113, 114, 116, 119, 121, 121, 121, 121, 121, 123, 126, 141, 59, 60, 62, 68,
+    70, 73, 75, 76, 76, 77, 78, 79, 80, 82, 89, 95, 95, 96, 97, 99,
+    100, 100, 100, 100, 104, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+    106, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 108, 113,
+    114, 115, 116, 117, 118, 119, 121, 122, 123, 125, 125, 125, 129, 132, 133, 138,
+    143, 69, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 71,
+    75, 75, 76, 81, 83, 85, 85, 87, 91, 92, 94, 94, 95, 96, 99, 100,
+    105, 109, 109, 111, 113, 117, 119, 121, 122, 123, 124, 125, 130, 134, 68, 69,
+    70, 71, 75, 81, 86, 87, 89, 92, 98, 99, 99, 99, 102, 104, 106, 110,
+    110, 110, 114, 115, 117, 117, 121, 121, 121, 121, 125, 132, 137, 138, 140, 143,
+    65, 66, 71, 75, 80, 82, 83, 88, 90, 92, 93, 93, 95, 101, 101, 105,
+    107, 110, 111, 112, 113, 113, 119, 122, 126, 127, 129, 132, 133, 134, 134, 139,
+    139, 63, 66, 66, 66, 66, 66, 66, 67, 70, 70, 70, 71, 74, 80, 83,
+    85, 86, 95, 98, 101, 103, 103, 103, 105, 107, 111, 114, 116, 117, 119, 120,
+    124, 128, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+    134, 134, 134, 135, 143, 63, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66,
+    66, 66, 66, 68, 70, 70, 70, 71, 71, 73, 73, 75, 82, 82, 82, 83,
+    93, 96, 97, 97, 100, 100, 102, 103, 110, 111, 111, 113, 114, 121, 131, 137,
+    60, 70, 73, 73, 74, 81, 82, 85, 87, 88, 93, 99, 102, 104, 110, 112,
+    114, 115, 117, 122, 125, 130, 130, 130, 136, 143, 67, 70, 72, 72, 77, 78,
+    80, 80, 80, 81, 82, 86, 89, 92, 103, 111, 114, 114, 114, 114, 114, 114,
+    115, 116, 117, 118, 121, 122, 122, 122, 123, 124, 129, 141, 66, 68, 68, 69,
+    69, 72, 74, 75, 75, 81, 84, 85, 86, 86, 86, 87, 89, 93, 96, 97,
+    98, 100, 100, 101, 103, 105, 111, 113, 114, 114, 114, 114, 114, 114, 115, 116,
+    122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 125, 125, 126,
+    131, 139, 139, 67, 71, 72, 74, 76, 78, 78, 88, 91, 98, 106, 110, 111,
+    118, 121, 124, 134, 139, 141, 65, 67, 68, 75, 76, 79, 80, 81, 83, 85,
+    87, 91, 93, 94, 96, 96, 102, 105, 107, 112, 120, 125, 127, 132, 136, 143,
+    65, 70, 70, 70, 70, 71, 71, 71, 72, 73, 74, 75, 75, 75, 75, 75,
+    75, 76, 76, 76, 86, 94, 94, 95, 96, 96, 96, 96, 96, 97, 99, 100,
+    101, 103, 106, 108, 109, 118, 123, 124, 127, 138, 138, 70, 70, 72, 74, 75,
+    75, 75, 75, 75, 75, 76, 76, 78, 79, 80, 81, 83, 84, 84, 87, 88,
+    91, 91, 95, 96, 96, 97, 98, 102, 102, 102, 102, 102, 102, 102, 104, 105,
+    106, 106, 106, 106, 107, 113, 113, 115, 116, 118, 118, 118, 118, 118, 118, 118,
+    118, 118, 126, 130, 139, 141, 70, 71, 72, 73, 75, 77, 77, 79, 83, 84,
+    88, 90, 91, 92, 95, 99, 101, 103, 106, 106, 106, 107, 107, 118, 119, 121,
+    121, 134, 146, 68, 73, 74, 75, 76, 78, 78, 78, 81, 82, 83, 83, 84,
+    86, 87, 87, 91, 91, 93, 97, 98, 100, 102, 104, 106, 110, 113, 114, 116,
+    120, 136, 63, 70, 72, 75, 75, 79, 80, 81, 81, 84, 86, 88, 90, 92,
+    94, 95, 95, 96, 96, 96, 96, 96, 96, 96, 97, 100, 103, 106, 113, 115,
+    115, 115, 117, 123, 123, 124, 128, 132, 147, 69, 71, 71, 73, 73, 73, 75,
+    77, 78, 80, 82, 84, 85, 87, 88, 91, 93, 93, 93, 94, 94, 95, 95,
+    95, 96, 96, 96, 97, 101, 102, 105, 107, 108, 110, 119, 120, 126, 128, 145,
+    145, 146, 67, 68, 68, 68, 68, 69, 71, 72, 74, 76, 77, 77, 77, 77,
+    79, 82, 86, 87, 88, 88, 89, 90, 91, 95, 95, 96, 97, 99, 101, 102,
+    103, 106, 107, 107, 109, 117, 119, 119, 122, 144, 68, 68, 68, 68, 68, 68,
+    74, 79, 80, 81, 83, 83, 84, 85, 85, 87, 89, 89, 89, 90, 90, 90,
+    92, 96, 101, 103, 105, 106, 108, 109, 112, 112, 112, 129, 138, 140, 140, 141,
+    141, 141, 141, 141, 141, 141, 141, 142, 66, 68, 70, 74, 77, 78, 79, 81,
+    81, 82, 84, 89, 89, 89, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 92, 92, 92,
+    92, 92, 92, 92, 93, 95, 97, 98, 99, 100, 101, 106, 110, 111, 113, 114,
+    118, 138, 138, 138, 68, 74, 75, 75, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 77, 77, 77, 79, 80,
+    81, 85, 86, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+    90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 92, 110, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 115, 118, 120,
+    123, 123, 125, 130, 137, 66, 68, 69, 69, 69, 69, 76, 77, 77, 77, 77,
+    82, 83, 85, 86, 89, 89, 89, 90, 90, 90, 90, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 92, 95, 96, 98, 99, 101, 101, 102, 104, 105,
+    106, 106, 106, 106, 106, 106, 107, 108, 109, 113, 115, 121, 125, 136, 69, 69,
+    69, 69, 70, 71, 71, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 78, 79, 80, 81, 83, 86,
+    86, 88, 89, 89, 89, 90, 90, 90, 90, 90, 90, 90, 91, 91, 91, 97,
+    98, 103, 105, 105, 105, 106, 106, 106, 107, 110, 111, 113, 123, 134, 68, 69,
+    69, 74, 77, 78, 81, 82, 82, 82, 82, 83, 83, 84, 86, 89, 90, 90,
+    94, 96, 99, 100, 102, 105, 110, 113, 118, 120, 120, 126, 130, 131, 131, 131,
+    131, 131, 132, 132, 133, 134, 73, 74, 75, 76, 76, 76, 77, 79, 80, 83,
+    89, 89, 91, 91, 92, 93, 94, 108, 112, 113, 131, 132, 132, 132, 132, 132,
+    132, 132, 132, 74, 74, 76, 77, 77, 77, 77, 77, 79, 83, 84, 86, 87,
+    89, 91, 92, 95, 96, 100, 103, 106, 114, 118, 123, 131, 74, 74, 76, 76,
+    77, 77, 77, 77, 78, 80, 87, 93, 93, 93, 93, 93, 93, 94, 100, 111,
+    114, 117, 117, 119, 119, 119, 119, 119, 129, 73, 73, 73, 73, 73, 74, 74,
+    74, 74, 74, 74, 74, 74, 75, 75, 75, 75, 75, 75, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 77, 78, 92, 95, 100, 103, 103, 104, 105, 108, 116,
+    118, 120, 123, 126, 127, 127, 127, 127, 73, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 77, 77, 77, 77, 77, 79,
+    79, 79, 79, 79, 81, 88, 91, 94, 97, 101, 106, 108, 108, 124, 125, 126,
+    126, 126, 127, 127, 127, 73, 73, 74, 74, 74, 74, 74, 74, 74, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    76, 76, 76, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    78, 78, 78, 79, 82, 84, 84, 85, 90, 101, 106, 109, 119, 123, 125, 125,
+    125, 125, 74, 74, 74, 74, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 76, 76, 76, 76, 76, 76, 76, 76, 76, 77, 77, 78, 80, 80,
+    81, 81, 83, 86, 90, 96, 110, 114, 124, 75, 76, 76, 76, 76, 76, 77,
+    77, 79, 82, 84, 86, 88, 90, 90, 90, 90, 90, 90, 91, 91, 91, 91,
+    93, 95, 97, 103, 78, 79, 81, 84, 84, 84, 84, 84, 89, 90, 91, 93,
+    102, 109, 118, 119, 80, 81, 83, 83, 83, 83, 83, 83, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 85, 85,
+    86, 86, 86, 88, 93, 94, 94, 94, 94, 94, 94, 94, 94, 95, 95, 95,
+    95, 95, 95, 95, 96, 98, 99, 100, 102, 103, 103, 106, 114, 115, 115, 115,
+    117, 83, 84, 85, 85, 85, 93, 94, 94, 95, 105, 105, 107, 109, 110, 111,
+    83, 83, 83, 83, 83, 83, 83, 83, 84, 84, 85, 87, 89, 94, 90, 92,
+    94, 96, 127, 127, 127, 129, 123,
+};
+#endif // LOCATION_SOA
+
+// =============================
+// 이름 정렬 인덱스 (locationNameList 행 번호, strcmp 오름차순)
+// =============================
+// 이진 탐색으로 이름 -> 행 번호. 같은 이름이 여러 개면 앞 행이 먼저 온다.
+constexpr uint16_t locationNameOrder[] PROGMEM = {
+    452, 555, 563, 564, 565, 559, 556, 557, 558, 560, 561, 562, 566, 567, 568, 502,
+    521, 522, 511, 512, 503, 504, 506, 513, 514, 515, 518, 519, 520, 516, 517, 509,
+    510, 507, 508, 505, 477, 487, 488, 489, 478, 479, 480, 481, 486, 482, 483, 484,
+    485, 523, 533, 534, 525, 535, 536, 526, 527, 528, 529, 530, 531, 532, 524, 622,
+    623, 624, 630, 625, 628, 626, 627, 629, 631, 605, 610, 611, 612, 613, 617, 609,
+    621, 619, 620, 614, 615, 618, 606, 607, 608, 616, 669, 674, 670, 673, 671, 672,
+    569, 584, 585, 580, 581, 582, 583, 586, 587, 573, 574, 575, 576, 577, 578, 579,
+    570, 571, 572, 453, 457, 458, 456, 455, 459, 454, 460, 461, 462, 537, 538, 539,
+    540, 541, 542, 548, 549, 551, 552, 553, 554, 550, 547, 543, 544, 545, 546, 588,
+    600, 601, 593, 603, 604, 589, 590, 591, 592, 602, 594, 595, 598, 599, 596, 597,
+    656, 660, 661, 668, 663, 662, 667, 664, 665, 666, 658, 659, 657, 463, 471, 476,
+    470, 472, 473, 464, 465, 466, 474, 475, 467, 468, 469, 645, 651, 652, 653, 654,
+    649, 650, 655, 646, 647, 648, 490, 495, 496, 497, 498, 499, 500, 501, 491, 494,
+    492, 493, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 1925,
+    2017, 2018, 2026, 2025, 2020, 2021, 2027, 2023, 2028, 2019, 2024, 2022, 1964, 1967, 1969, 1970,
+    1965, 1966, 1972, 1968, 1971, 1952, 1957, 1958, 1960, 1961, 1959, 1954, 1962, 1963, 1955, 1953,
+    1956, 1926, 1929, 1936, 1932, 1928, 1931, 1930, 1927, 1933, 1934, 1935, 1938, 1939, 1937, 1940,
+    1948, 1942, 1946, 1941, 1945, 1943, 1944, 1947, 1951, 1949, 1950, 1973, 1980, 1995, 1996, 1977,
+    1994, 1983, 1985, 1982, 1988, 1989, 1993, 1991, 1974, 1981, 1998, 1992, 1979, 1975, 1984, 1987,
+    1978, 1986, 1976, 1997, 1990, 2084, 2087, 2092, 2085, 2090, 2088, 2091, 2086, 2089, 2074, 2080,
+    2075, 2083, 2076, 2079, 2082, 2081, 2077, 2078, 2062, 2073, 2070, 2069, 2067, 2064, 2063, 2065,
+    2068, 2071, 2072, 2066, 1999, 2006, 2000, 2015, 2002, 2004, 2001, 2008, 2005, 2016, 2010, 2011,
+    2014, 2007, 2003, 2009, 2012, 2013, 2051, 2053, 2052, 2054, 2059, 2057, 2056, 2061, 2060, 2055,
+    2058, 2029, 2033, 2032, 2035, 2034, 2031, 2038, 2037, 2036, 2030, 2039, 2043, 2048, 2042, 2044,
+    2045, 2050, 2046, 2049, 2040, 2047, 2041, 2093, 2161, 2163, 2171, 2167, 2166, 2169, 2173, 2174,
+    2175, 2176, 2177, 2178, 2170, 2172, 2164, 2165, 2162, 2168, 2144, 2148, 2150, 2149, 2156, 2157,
+    2158, 2159, 2160, 2155, 2146, 2152, 2153, 2151, 2147, 2154, 2145, 2242, 2243, 2258, 2252, 2245,
+    2248, 2244, 2249, 2254, 2255, 2247, 2251, 2246, 2250, 2256, 2257, 2253, 2094, 2107, 2098, 2101,
+    2110, 2102, 2097, 2108, 2103, 2095, 2104, 2096, 2099, 2111, 2109, 2100, 2105, 2106, 2112, 2122,
+    2123, 2124, 2125, 2126, 2116, 2115, 2114, 2113, 2117, 2118, 2119, 2120, 2121, 2273, 2283, 2279,
+    2274, 2276, 2282, 2280, 2277, 2278, 2281, 2275, 2216, 2221, 2228, 2229, 2230, 2219, 2217, 2222,
+    2223, 2220, 2226, 2218, 2227, 2224, 2225, 2231, 2240, 2235, 2241, 2232, 2233, 2236, 2234, 2239,
+    2238, 2237, 2127, 2132, 2140, 2131, 2129, 2134, 2138, 2141, 2136, 2142, 2137, 2130, 2133, 2139,
+    2135, 2143, 2128, 2211, 2212, 2213, 2215, 2214, 2284, 2291, 2294, 2288, 2295, 2286, 2292, 2287,
+    2289, 2285, 2290, 2293, 2195, 2204, 2210, 2202, 2208, 2209, 2207, 2196, 2206, 2199, 2200, 2201,
+    2198, 2205, 2197, 2203, 2259, 2271, 2264, 2265, 2263, 2260, 2270, 2266, 2262, 2268, 2269, 2272,
+    2261, 2267, 2179, 2190, 2182, 2180, 2191, 2192, 2186, 2189, 2188, 2181, 2184, 2183, 2194, 2185,
+    2193, 2187, 2309, 2311, 2314, 2312, 2317, 2313, 2315, 2310, 2316, 2296, 2305, 2302, 2299, 2304,
+    2303, 2306, 2301, 2308, 2298, 2307, 2300, 2297, 675, 744, 755, 756, 746, 747, 748, 749,
+    754, 765, 764, 757, 745, 762, 767, 763, 759, 758, 766, 750, 751, 752, 753, 760,
+    761, 792, 815, 804, 812, 794, 795, 796, 801, 802, 798, 807, 797, 809, 810, 811,
+    793, 803, 813, 814, 805, 806, 799, 800, 808, 816, 819, 823, 825, 824, 817, 822,
+    818, 821, 820, 689, 706, 707, 708, 709, 704, 701, 703, 700, 711, 705, 710, 698,
+    699, 702, 690, 691, 692, 693, 694, 695, 696, 697, 826, 830, 827, 829, 834, 833,
+    828, 831, 832, 676, 687, 688, 682, 677, 683, 684, 685, 686, 678, 679, 680, 681,
+    730, 732, 733, 734, 735, 742, 743, 736, 737, 738, 739, 740, 741, 731, 712, 716,
+    717, 718, 719, 720, 721, 713, 714, 715, 722, 723, 724, 725, 726, 727, 728, 729,
+    768, 769, 770, 771, 772, 787, 788, 784, 789, 790, 791, 779, 780, 785, 786, 781,
+    773, 774, 775, 783, 782, 776, 777, 778, 1104, 1179, 1190, 1191, 1183, 1181, 1188, 1182,
+    1185, 1189, 1180, 1187, 1186, 1184, 1105, 1112, 1120, 1114, 1115, 1118, 1107, 1113, 1106, 1109,
+    1110, 1119, 1121, 1117, 1108, 1116, 1111, 1122, 1130, 1126, 1129, 1123, 1125, 1124, 1127, 1137,
+    1138, 1132, 1139, 1128, 1133, 1134, 1131, 1135, 1136, 1140, 1141, 1145, 1157, 1142, 1143, 1161,
+    1162, 1164, 1149, 1151, 1152, 1156, 1160, 1148, 1158, 1159, 1144, 1163, 1150, 1147, 1153, 1154,
+    1155, 1146, 1165, 1176, 1177, 1167, 1175, 1166, 1171, 1172, 1173, 1169, 1170, 1168, 1174, 1178,
+    3361, 3528, 3529, 3532, 3531, 3535, 3536, 3534, 3530, 3539, 3533, 3537, 3538, 3362, 3370, 3364,
+    3371, 3365, 3386, 3376, 3373, 3378, 3379, 3380, 3381, 3382, 3383, 3374, 3367, 3372, 3369, 3368,
+    3384, 3363, 3366, 3387, 3377, 3385, 3375, 3436, 3442, 3440, 3444, 3439, 3437, 3441, 3445, 3443,
+    3446, 3438, 3414, 3430, 3419, 3433, 3418, 3435, 3426, 3427, 3423, 3415, 3424, 3432, 3425, 3420,
+    3428, 3429, 3421, 3434, 3416, 3431, 3417, 3422, 3559, 3560, 3561, 3562, 3563, 3565, 3564, 3489,
+    3492, 3495, 3493, 3494, 3498, 3496, 3490, 3497, 3491, 3478, 3487, 3481, 3479, 3480, 3488, 3482,
+    3485, 3486, 3483, 3484, 3540, 3542, 3543, 3541, 3545, 3544, 3552, 3555, 3556, 3553, 3554, 3558,
+    3557, 3518, 3524, 3520, 3526, 3525, 3519, 3523, 3521, 3522, 3527, 3509, 3512, 3514, 3517, 3513,
+    3516, 3511, 3510, 3515, 3465, 3466, 3472, 3468, 3475, 3469, 3476, 3471, 3474, 3470, 3477, 3473,
+    3467, 3456, 3463, 3464, 3458, 3459, 3460, 3462, 3461, 3457, 3447, 3455, 3454, 3448, 3449, 3453,
+    3452, 3450, 3451, 3388, 3413, 3410, 3393, 3403, 3406, 3400, 3394, 3411, 3405, 3395, 3391, 3404,
+    3392, 3398, 3389, 3412, 3401, 3402, 3396, 3397, 3390, 3408, 3409, 3407, 3399, 3546, 3550, 3549,
+    3548, 3551, 3547, 3566, 3572, 3570, 3571, 3568, 3569, 3567, 3499, 3504, 3503, 3506, 3507, 3508,
+    3505, 3501, 3502, 3500, 1002, 1054, 1064, 1070, 1071, 1072, 1079, 1074, 1058, 1057, 1056, 1055,
+    1075, 1068, 1069, 1067, 1076, 1077, 1066, 1073, 1078, 1059, 1081, 1061, 1062, 1063, 1065, 1080,
+    1060, 1003, 1004, 1005, 1006, 1007, 1013, 1014, 1010, 1011, 1015, 1016, 1008, 1009, 1012, 1082,
+    1091, 1102, 1092, 1093, 1099, 1085, 1087, 1097, 1098, 1100, 1101, 1103, 1094, 1086, 1083, 1084,
+    1096, 1095, 1088, 1089, 1090, 1036, 1046, 1047, 1038, 1039, 1040, 1041, 1053, 1051, 1050, 1048,
+    1049, 1042, 1052, 1043, 1044, 1045, 1037, 1017, 1024, 1035, 1032, 1033, 1022, 1027, 1028, 1029,
+    1030, 1020, 1021, 1034, 1025, 1026, 1031, 1018, 1019, 1023, 1279, 1539, 1545, 1547, 1551, 1541,
+    1543, 1542, 1548, 1549, 1550, 1546, 1540, 1544, 1525, 1538, 1537, 1531, 1532, 1533, 1534, 1530,
+    1527, 1526, 1528, 1529, 1536, 1535, 1775, 1788, 1789, 1790, 1777, 1781, 1778, 1776, 1787, 1784,
+    1785, 1780, 1786, 1779, 1783, 1782, 1412, 1427, 1413, 1414, 1415, 1416, 1420, 1417, 1429, 1418,
+    1423, 1424, 1425, 1426, 1419, 1422, 1421, 1428, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404,
+    1405, 1406, 1410, 1411, 1409, 1407, 1408, 1462, 1467, 1466, 1468, 1463, 1469, 1464, 1465, 1451,
+    1456, 1458, 1457, 1453, 1452, 1460, 1461, 1454, 1455, 1459, 1430, 1439, 1440, 1442, 1443, 1444,
+    1445, 1446, 1447, 1448, 1449, 1450, 1431, 1432, 1433, 1436, 1434, 1435, 1441, 1437, 1438, 1516,
+    1520, 1521, 1519, 1517, 1518, 1524, 1522, 1523, 1905, 1911, 1908, 1906, 1910, 1909, 1907, 1791,
+    1795, 1798, 1793, 1803, 1797, 1802, 1799, 1804, 1801, 1800, 1792, 1805, 1796, 1794, 1552, 1561,
+    1573, 1562, 1563, 1567, 1568, 1569, 1570, 1571, 1555, 1572, 1565, 1566, 1558, 1553, 1564, 1559,
+    1560, 1556, 1557, 1554, 1574, 1580, 1581, 1597, 1598, 1586, 1584, 1585, 1578, 1576, 1577, 1582,
+    1583, 1579, 1575, 1591, 1592, 1587, 1595, 1588, 1589, 1590, 1593, 1594, 1596, 1663, 1673, 1668,
+    1672, 1664, 1665, 1674, 1669, 1670, 1666, 1667, 1675, 1671, 1607, 1609, 1608, 1611, 1612, 1610,
+    1613, 1614, 1615, 1599, 1604, 1603, 1602, 1605, 1600, 1606, 1601, 1836, 1837, 1839, 1838, 1847,
+    1848, 1843, 1842, 1841, 1852, 1849, 1850, 1851, 1844, 1845, 1846, 1840, 1470, 1478, 1479, 1480,
+    1481, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1482, 1483, 1484, 1485, 1489, 1488, 1486, 1487,
+    1683, 1684, 1694, 1693, 1687, 1688, 1689, 1690, 1691, 1695, 1696, 1697, 1685, 1686, 1692, 1806,
+    1824, 1812, 1807, 1822, 1823, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1825, 1826,
+    1809, 1817, 1819, 1821, 1813, 1811, 1810, 1816, 1820, 1815, 1814, 1808, 1818, 1760, 1764, 1762,
+    1771, 1767, 1774, 1765, 1761, 1772, 1773, 1766, 1768, 1769, 1763, 1770, 1616, 1632, 1623, 1630,
+    1631, 1628, 1626, 1619, 1620, 1618, 1625, 1621, 1627, 1624, 1622, 1617, 1629, 1633, 1641, 1635,
+    1636, 1634, 1637, 1640, 1638, 1639, 1739, 1742, 1750, 1751, 1752, 1746, 1753, 1749, 1748, 1743,
+    1740, 1741, 1747, 1745, 1754, 1755, 1756, 1757, 1758, 1759, 1744, 1866, 1872, 1870, 1868, 1877,
+    1878, 1875, 1874, 1869, 1879, 1880, 1871, 1867, 1876, 1873, 1490, 1492, 1510, 1511, 1494, 1514,
+    1515, 1497, 1499, 1495, 1503, 1500, 1498, 1491, 1493, 1513, 1501, 1496, 1505, 1506, 1507, 1504,
+    1502, 1509, 1508, 1512, 1358, 1376, 1359, 1377, 1379, 1378, 1369, 1370, 1363, 1364, 1365, 1366,
+    1374, 1375, 1367, 1368, 1360, 1361, 1362, 1380, 1371, 1372, 1373, 1346, 1357, 1351, 1352, 1349,
+    1350, 1356, 1348, 1353, 1354, 1355, 1347, 1328, 1341, 1338, 1344, 1339, 1345, 1343, 1329, 1330,
+    1331, 1336, 1337, 1332, 1333, 1334, 1335, 1342, 1340, 1642, 1656, 1657, 1643, 1646, 1662, 1649,
+    1658, 1660, 1652, 1653, 1654, 1655, 1651, 1647, 1648, 1661, 1644, 1645, 1650, 1659, 1291, 1298,
+    1302, 1297, 1300, 1301, 1299, 1303, 1295, 1296, 1292, 1293, 1294, 1280, 1283, 1284, 1285, 1288,
+    1289, 1281, 1287, 1286, 1290, 1282, 1304, 1307, 1314, 1308, 1309, 1313, 1310, 1305, 1306, 1311,
+    1312, 1315, 1326, 1327, 1316, 1317, 1318, 1319, 1324, 1325, 1320, 1321, 1322, 1323, 1381, 1393,
+    1396, 1394, 1384, 1385, 1392, 1386, 1395, 1387, 1388, 1389, 1390, 1391, 1382, 1383, 1676, 1678,
+    1682, 1677, 1680, 1681, 1679, 1853, 1854, 1855, 1857, 1861, 1862, 1863, 1858, 1856, 1864, 1865,
+    1859, 1860, 1912, 1920, 1919, 1924, 1915, 1914, 1922, 1917, 1918, 1921, 1913, 1916, 1923, 1881,
+    1888, 1887, 1882, 1889, 1885, 1884, 1883, 1892, 1893, 1890, 1886, 1891, 1894, 1899, 1898, 1897,
+    1904, 1896, 1903, 1900, 1902, 1901, 1895, 1698, 1704, 1710, 1701, 1706, 1700, 1702, 1699, 1708,
+    1703, 1705, 1707, 1709, 1711, 1726, 1717, 1722, 1723, 1724, 1718, 1715, 1720, 1721, 1716, 1725,
+    1719, 1712, 1713, 1714, 1727, 1734, 1731, 1732, 1733, 1728, 1729, 1735, 1736, 1737, 1738, 1730,
+    2638, 2717, 2738, 2720, 2730, 2741, 2727, 2723, 2728, 2726, 2732, 2733, 2724, 2725, 2731, 2739,
+    2722, 2718, 2737, 2735, 2721, 2740, 2736, 2719, 2729, 2734, 2958, 2962, 2959, 2961, 2963, 2965,
+    2960, 2966, 2967, 2968, 2964, 2906, 2908, 2911, 2909, 2914, 2907, 2912, 2915, 2910, 2913, 2880,
+    2886, 2883, 2881, 2884, 2885, 2888, 2882, 2887, 2936, 2938, 2941, 2942, 2944, 2940, 2939, 2937,
+    2943, 2694, 2695, 2701, 2707, 2708, 2714, 2702, 2713, 2700, 2698, 2703, 2699, 2705, 2710, 2709,
+    2715, 2706, 2704, 2697, 2696, 2711, 2712, 2716, 2916, 2917, 2921, 2918, 2922, 2920, 2924, 2923,
+    2919, 2742, 2760, 2748, 2753, 2744, 2767, 2761, 2749, 2756, 2757, 2763, 2764, 2750, 2765, 2754,
+    2746, 2747, 2745, 2762, 2755, 2743, 2758, 2759, 2751, 2752, 2766, 2670, 2672, 2693, 2692, 2682,
+    2691, 2671, 2681, 2673, 2686, 2684, 2690, 2680, 2683, 2675, 2677, 2674, 2678, 2679, 2687, 2685,
+    2688, 2676, 2689, 2845, 2848, 2859, 2860, 2846, 2850, 2847, 2855, 2854, 2856, 2853, 2852, 2857,
+    2858, 2849, 2851, 2830, 2837, 2832, 2835, 2840, 2841, 2842, 2843, 2844, 2838, 2831, 2839, 2836,
+    2834, 2833, 2654, 2657, 2667, 2661, 2659, 2655, 2669, 2668, 2664, 2660, 2662, 2656, 2658, 2666,
+    2663, 2665, 2639, 2650, 2653, 2643, 2644, 2640, 2648, 2646, 2652, 2645, 2651, 2642, 2647, 2649,
+    2641, 2805, 2825, 2810, 2827, 2828, 2820, 2821, 2811, 2826, 2806, 2818, 2816, 2823, 2817, 2822,
+    2807, 2814, 2815, 2813, 2809, 2824, 2812, 2819, 2808, 2829, 2925, 2933, 2934, 2932, 2930, 2931,
+    2926, 2927, 2929, 2935, 2928, 2861, 2875, 2878, 2879, 2871, 2870, 2867, 2876, 2874, 2863, 2873,
+    2868, 2869, 2872, 2864, 2865, 2866, 2877, 2862, 2969, 2972, 2978, 2973, 2974, 2977, 2976, 2979,
+    2975, 2971, 2970, 2980, 2983, 2984, 2982, 2981, 2945, 2950, 2957, 2953, 2949, 2947, 2956, 2954,
+    2955, 2946, 2952, 2948, 2951, 2788, 2798, 2790, 2799, 2800, 2789, 2797, 2793, 2794, 2792, 2796,
+    2795, 2801, 2804, 2802, 2791, 2803, 2896, 2904, 2905, 2902, 2900, 2898, 2901, 2899, 2897, 2903,
+    2768, 2774, 2775, 2778, 2777, 2786, 2787, 2780, 2783, 2784, 2785, 2770, 2773, 2772, 2769, 2771,
+    2779, 2776, 2781, 2782, 2889, 2892, 2891, 2893, 2895, 2894, 2890, 2985, 3203, 3217, 3204, 3208,
+    3211, 3215, 3216, 3206, 3212, 3209, 3214, 3205, 3207, 3213, 3210, 3032, 3037, 3033, 3041, 3036,
+    3039, 3040, 3042, 3038, 3035, 3043, 3044, 3045, 3034, 3003, 3009, 3004, 3015, 3017, 3008, 3014,
+    3006, 3005, 3007, 3012, 3011, 3016, 3018, 3013, 3010, 3019, 3031, 3029, 3030, 3027, 3028, 3024,
+    3021, 3022, 3020, 3023, 3025, 3026, 2994, 2995, 3000, 2997, 2998, 2999, 3001, 3002, 2996, 2986,
+    2993, 2988, 2989, 2987, 2992, 2991, 2990, 3282, 3287, 3294, 3293, 3283, 3286, 3284, 3289, 3291,
+    3290, 3292, 3285, 3288, 3145, 3157, 3147, 3150, 3149, 3161, 3153, 3146, 3154, 3160, 3155, 3148,
+    3156, 3158, 3159, 3151, 3162, 3163, 3152, 3108, 3120, 3124, 3118, 3121, 3115, 3116, 3112, 3117,
+    3122, 3125, 3126, 3127, 3111, 3109, 3110, 3119, 3113, 3123, 3114, 3218, 3224, 3231, 3227, 3232,
+    3219, 3228, 3222, 3221, 3229, 3230, 3220, 3223, 3225, 3226, 3295, 3297, 3305, 3302, 3311, 3307,
+    3304, 3310, 3299, 3296, 3306, 3298, 3309, 3308, 3303, 3300, 3312, 3301, 3244, 3247, 3254, 3255,
+    3251, 3257, 3250, 3245, 3249, 3246, 3248, 3252, 3256, 3253, 3192, 3197, 3200, 3199, 3194, 3198,
+    3193, 3196, 3195, 3201, 3202, 3270, 3277, 3280, 3281, 3271, 3273, 3276, 3272, 3278, 3279, 3275,
+    3274, 3046, 3063, 3070, 3076, 3056, 3061, 3075, 3050, 3057, 3068, 3053, 3073, 3052, 3049, 3058,
+    3051, 3055, 3065, 3059, 3047, 3060, 3048, 3074, 3071, 3054, 3066, 3067, 3069, 3064, 3072, 3062,
+    3128, 3131, 3139, 3137, 3135, 3143, 3144, 3130, 3138, 3141, 3140, 3142, 3129, 3132, 3136, 3134,
+    3133, 3233, 3243, 3241, 3235, 3238, 3239, 3234, 3237, 3236, 3240, 3242, 3093, 3105, 3098, 3102,
+    3104, 3100, 3099, 3106, 3095, 3107, 3094, 3096, 3103, 3101, 3097, 3258, 3260, 3266, 3263, 3261,
+    3268, 3262, 3264, 3259, 3265, 3267, 3269, 3077, 3091, 3089, 3085, 3080, 3081, 3083, 3088, 3087,
+    3090, 3092, 3086, 3078, 3084, 3082, 3079, 3178, 3189, 3188, 3181, 3182, 3180, 3190, 3183, 3185,
+    3186, 3187, 3179, 3184, 3191, 3164, 3177, 3166, 3173, 3169, 3170, 3165, 3176, 3172, 3168, 3174,
+    3175, 3167, 3171, 3359, 3360, 835, 920, 937, 938, 939, 921, 922, 923, 924, 925, 926,
+    931, 932, 933, 934, 940, 935, 936, 927, 928, 929, 930, 941, 942, 849, 860, 851,
+    852, 850, 853, 854, 855, 856, 857, 858, 859, 980, 983, 981, 984, 991, 988, 985,
+    987, 992, 993, 982, 990, 986, 989, 943, 946, 947, 948, 949, 953, 954, 955, 944,
+    945, 950, 951, 952, 836, 842, 840, 843, 839, 838, 847, 837, 844, 845, 846, 848,
+    841, 861, 871, 872, 881, 869, 870, 873, 874, 875, 876, 877, 878, 879, 880, 882,
+    863, 862, 864, 865, 866, 867, 868, 899, 904, 905, 906, 907, 900, 901, 902, 903,
+    914, 908, 909, 910, 911, 912, 913, 916, 917, 918, 919, 915, 994, 996, 995, 997,
+    998, 1000, 999, 1001, 956, 979, 974, 959, 960, 961, 976, 962, 963, 964, 969, 970,
+    971, 972, 957, 973, 978, 977, 965, 966, 967, 968, 975, 958, 883, 890, 891, 892,
+    893, 884, 885, 886, 894, 895, 896, 897, 898, 887, 888, 889, 3313, 3314, 3316, 3334,
+    3333, 3320, 3340, 3330, 3317, 3319, 3315, 3331, 3324, 3325, 3339, 3322, 3323, 3318, 3337, 3338,
+    3335, 3326, 3327, 3332, 3321, 3336, 3328, 3329, 3341, 3345, 3350, 3356, 3342, 3355, 3353, 3351,
+    3348, 3349, 3357, 3343, 3346, 3354, 3344, 3347, 3352, 3358, 2318, 2481, 2483, 2488, 2482, 2491,
+    2486, 2492, 2490, 2485, 2489, 2484, 2493, 2487, 2430, 2432, 2435, 2436, 2442, 2431, 2434, 2438,
+    2433, 2437, 2441, 2440, 2439, 2519, 2528, 2522, 2523, 2524, 2520, 2521, 2527, 2530, 2529, 2526,
+    2525, 2464, 2472, 2477, 2468, 2470, 2476, 2480, 2466, 2478, 2469, 2465, 2474, 2473, 2475, 2471,
+    2467, 2479, 2443, 2450, 2444, 2453, 2452, 2449, 2448, 2445, 2451, 2454, 2446, 2447, 2455, 2458,
+    2456, 2461, 2460, 2457, 2463, 2459, 2462, 2417, 2419, 2424, 2428, 2425, 2418, 2427, 2422, 2423,
+    2426, 2421, 2420, 2429, 2531, 2538, 2537, 2540, 2532, 2542, 2534, 2545, 2535, 2541, 2544, 2539,
+    2533, 2543, 2536, 2568, 2574, 2573, 2576, 2572, 2569, 2575, 2571, 2570, 2577, 2494, 2504, 2498,
+    2497, 2502, 2501, 2507, 2505, 2496, 2495, 2503, 2499, 2500, 2506, 2508, 2513, 2517, 2511, 2510,
+    2518, 2514, 2509, 2515, 2512, 2516, 2590, 2601, 2600, 2599, 2594, 2597, 2591, 2592, 2593, 2596,
+    2595, 2598, 2615, 2618, 2617, 2620, 2616, 2621, 2622, 2619, 2319, 2341, 2342, 2333, 2326, 2328,
+    2337, 2335, 2332, 2330, 2327, 2340, 2329, 2339, 2336, 2323, 2338, 2325, 2322, 2324, 2320, 2321,
+    2334, 2331, 2558, 2563, 2566, 2564, 2560, 2565, 2562, 2559, 2561, 2567, 2396, 2400, 2416, 2409,
+    2408, 2403, 2402, 2406, 2412, 2401, 2415, 2404, 2397, 2405, 2407, 2398, 2413, 2410, 2399, 2411,
+    2414, 2623, 2625, 2637, 2635, 2629, 2630, 2632, 2631, 2627, 2628, 2634, 2626, 2624, 2636, 2633,
+    2371, 2381, 2387, 2393, 2373, 2375, 2383, 2391, 2390, 2386, 2377, 2392, 2384, 2380, 2389, 2379,
+    2388, 2385, 2382, 2374, 2372, 2378, 2394, 2395, 2376, 2602, 2613, 2610, 2612, 2604, 2608, 2606,
+    2605, 2614, 2607, 2611, 2603, 2609, 2546, 2549, 2553, 2550, 2554, 2556, 2557, 2548, 2555, 2552,
+    2551, 2547, 2578, 2580, 2588, 2584, 2582, 2586, 2585, 2581, 2583, 2589, 2587, 2579, 2343, 2354,
+    2357, 2344, 2351, 2363, 2358, 2355, 2352, 2349, 2347, 2353, 2368, 2364, 2362, 2361, 2370, 2348,
+    2369, 2350, 2356, 2366, 2345, 2365, 2359, 2367, 2360, 2346, 3573, 3817, 3826, 3823, 3818, 3824,
+    3820, 3822, 3821, 3828, 3825, 3829, 3819, 3827, 3830, 3716, 3721, 3719, 3728, 3722, 3724, 3734,
+    3727, 3730, 3723, 3731, 3735, 3729, 3726, 3718, 3717, 3725, 3733, 3732, 3720, 3802, 3805, 3816,
+    3811, 3803, 3807, 3804, 3809, 3813, 3806, 3808, 3814, 3810, 3812, 3815, 3610, 3616, 3631, 3617,
+    3630, 3629, 3622, 3627, 3613, 3614, 3628, 3626, 3637, 3619, 3633, 3634, 3635, 3620, 3611, 3612,
+    3621, 3625, 3618, 3615, 3624, 3636, 3632, 3623, 3638, 3651, 3657, 3664, 3649, 3642, 3639, 3641,
+    3656, 3654, 3658, 3647, 3660, 3659, 3646, 3640, 3666, 3655, 3652, 3667, 3644, 3665, 3661, 3643,
+    3650, 3662, 3663, 3648, 3645, 3653, 3777, 3779, 3788, 3787, 3786, 3778, 3789, 3783, 3785, 3782,
+    3784, 3781, 3780, 3769, 3772, 3774, 3776, 3775, 3773, 3770, 3771, 3668, 3670, 3681, 3688, 3675,
+    3679, 3673, 3671, 3676, 3685, 3677, 3686, 3690, 3680, 3691, 3682, 3683, 3687, 3669, 3672, 3684,
+    3678, 3674, 3689, 3594, 3599, 3600, 3604, 3609, 3596, 3597, 3598, 3595, 3607, 3601, 3605, 3606,
+    3602, 3603, 3608, 3574, 3579, 3589, 3590, 3591, 3592, 3593, 3575, 3581, 3582, 3577, 3576, 3584,
+    3585, 3586, 3587, 3588, 3580, 3583, 3578, 3750, 3753, 3756, 3759, 3754, 3760, 3751, 3761, 3758,
+    3755, 3757, 3752, 3762, 3767, 3768, 3766, 3763, 3764, 3765, 3692, 3706, 3703, 3699, 3700, 3702,
+    3709, 3715, 3712, 3698, 3714, 3705, 3708, 3694, 3710, 3697, 3711, 3701, 3704, 3707, 3696, 3695,
+    3693, 3713, 3790, 3798, 3793, 3795, 3801, 3792, 3799, 3796, 3794, 3797, 3791, 3800, 3736, 3745,
+    3738, 3748, 3744, 3743, 3749, 3747, 3741, 3737, 3740, 3742, 3746, 3739, 1253, 1254, 1271, 1275,
+    1276, 1258, 1277, 1278, 1268, 1269, 1259, 1273, 1270, 1265, 1260, 1263, 1262, 1255, 1272, 1267,
+    1266, 1274, 1264, 1257, 1256, 1261, 0, 153, 165, 166, 167, 154, 155, 156, 157, 158,
+    159, 160, 161, 162, 163, 164, 86, 95, 91, 92, 96, 97, 98, 99, 100, 93,
+    94, 88, 89, 90, 87, 324, 337, 331, 325, 326, 332, 333, 334, 335, 336, 327,
+    328, 329, 330, 338, 339, 188, 190, 191, 195, 196, 197, 198, 192, 193, 194, 202,
+    204, 189, 200, 201, 203, 199, 139, 145, 146, 147, 152, 141, 144, 140, 143, 142,
+    148, 149, 150, 151, 432, 440, 441, 442, 443, 444, 445, 450, 451, 433, 449, 438,
+    439, 436, 437, 434, 435, 446, 447, 448, 381, 385, 386, 389, 390, 391, 394, 395,
+    396, 397, 398, 399, 402, 401, 383, 384, 387, 388, 400, 382, 403, 392, 393, 256,
+    271, 274, 275, 276, 258, 259, 260, 268, 269, 270, 273, 265, 261, 262, 263, 264,
+    266, 267, 272, 257, 294, 296, 297, 298, 299, 295, 300, 301, 302, 303, 304, 277,
+    287, 288, 289, 284, 285, 286, 279, 280, 281, 282, 283, 293, 290, 291, 278, 292,
+    340, 341, 342, 346, 358, 347, 344, 349, 357, 348, 360, 345, 350, 361, 356, 359,
+    343, 353, 351, 355, 354, 352, 70, 72, 83, 84, 85, 78, 71, 79, 80, 81,
+    82, 73, 74, 75, 76, 77, 1, 5, 14, 15, 16, 2, 9, 8, 13, 12,
+    10, 11, 7, 6, 3, 4, 17, 18, 19, 30, 28, 32, 26, 25, 21, 33,
+    24, 34, 22, 23, 27, 31, 20, 29, 101, 110, 111, 114, 115, 112, 113, 105,
+    102, 107, 103, 104, 106, 108, 109, 116, 117, 220, 221, 225, 223, 222, 230, 231,
+    232, 236, 228, 229, 234, 235, 227, 226, 233, 224, 168, 172, 173, 174, 175, 177,
+    179, 178, 176, 180, 187, 181, 182, 183, 184, 185, 186, 169, 170, 171, 362, 374,
+    375, 376, 377, 373, 369, 370, 371, 372, 368, 367, 380, 363, 364, 365, 366, 378,
+    379, 205, 207, 218, 219, 206, 208, 214, 215, 211, 213, 212, 216, 217, 209, 210,
+    118, 124, 125, 122, 123, 121, 130, 131, 135, 136, 137, 126, 127, 128, 129, 132,
+    120, 138, 119, 133, 134, 52, 59, 60, 61, 62, 57, 58, 55, 63, 56, 64,
+    65, 66, 67, 68, 54, 53, 69, 404, 411, 412, 420, 421, 419, 407, 408, 427,
+    428, 429, 430, 431, 426, 424, 409, 410, 422, 423, 414, 413, 405, 406, 418, 417,
+    415, 416, 425, 237, 238, 239, 240, 241, 242, 250, 251, 252, 253, 254, 255, 243,
+    244, 245, 246, 247, 248, 249, 305, 321, 322, 323, 309, 310, 311, 312, 315, 316,
+    317, 318, 319, 320, 313, 314, 307, 306, 308, 35, 51, 39, 44, 49, 36, 42,
+    45, 46, 47, 48, 38, 50, 40, 41, 43, 37, 1192, 1231, 1235, 1236, 1232, 1233,
+    1234, 1237, 1238, 1239, 1221, 1222, 1225, 1224, 1223, 1226, 1227, 1228, 1229, 1230, 1193, 1195,
+    1196, 1197, 1202, 1203, 1201, 1194, 1198, 1205, 1200, 1199, 1204, 1206, 1217, 1212, 1215, 1216,
+    1214, 1213, 1219, 1207, 1208, 1209, 1210, 1211, 1218, 1220, 1240, 1244, 1245, 1249, 1250, 1242,
+    1241, 1243, 1252, 1246, 1251, 1247, 1248,
+};
+
+// =============================
+// 단어 인덱스 (마지막 이름 단계를 소문자·'-' 제거로 정렬한 행 번호)
+// =============================
+// "samyang" -> "... Samyang-Dong" 처럼 단어 앞부분으로 찾을 때 이진 탐색한다.
+constexpr uint16_t locationTokenOrder[] PROGMEM = {
+    385, 2625, 2848, 3316, 221, 3157, 3247, 471, 476, 440, 441, 442, 2637, 124, 3753, 2886,
+    3345, 2717, 2672, 2738, 1980, 2875, 3492, 2774, 1492, 2635, 2311, 2033, 2032, 2878, 533, 534,
+    2879, 1538, 1539, 1525, 1788, 1789, 1790, 3767, 1775, 706, 707, 708, 709, 3277, 1398, 1399,
+    1400, 1401, 1402, 1403, 1404, 1405, 1406, 2513, 1412, 1397, 2695, 979, 3334, 1271, 3805, 2161,
+    3706, 2163, 1656, 1657, 1704, 2504, 2059, 3721, 1899, 1376, 3280, 996, 1764, 3719, 3826, 1580,
+    1581, 2122, 1854, 2580, 1046, 1047, 1545, 2006, 3756, 1410, 1411, 3442, 271, 374, 375, 376,
+    377, 373, 704, 1222, 165, 166, 167, 274, 275, 276, 411, 412, 1275, 3413, 1038, 1039,
+    3512, 3550, 1195, 1196, 2400, 369, 370, 371, 372, 368, 2132, 2995, 584, 585, 1537, 1824,
+    580, 581, 582, 583, 1190, 1191, 2962, 2588, 3197, 1742, 2204, 2483, 3105, 1456, 521, 522,
+    769, 770, 771, 772, 1427, 487, 488, 489, 787, 788, 1244, 145, 146, 147, 3772, 1091,
+    2871, 1812, 2283, 3745, 2416, 2629, 2271, 1510, 1511, 1183, 716, 1413, 717, 1414, 1415, 718,
+    719, 720, 721, 2760, 3823, 2693, 2018, 2017, 1777, 2613, 51, 3703, 1726, 1957, 1958, 3798,
+    755, 756, 1341, 2488, 525, 1197, 1141, 2240, 125, 2950, 815, 3031, 1995, 1807, 732, 733,
+    734, 3738, 3333, 2419, 2959, 2958, 2409, 2775, 1960, 1961, 2107, 3728, 3091, 3514, 495, 496,
+    2472, 2993, 3410, 2305, 2432, 2701, 3297, 1040, 1041, 2961, 3189, 2000, 2870, 1531, 1532, 1533,
+    804, 1102, 1717, 341, 1276, 2144, 1520, 2482, 2481, 457, 5, 511, 512, 3818, 3817, 3816,
+    1762, 3131, 2210, 1462, 1451, 1430, 2190, 937, 938, 939, 1258, 1534, 1678, 3440, 610, 611,
+    612, 613, 3217, 3759, 830, 2707, 1416, 2341, 2202, 503, 504, 2342, 207, 2798, 3487, 2859,
+    3120, 3254, 995, 218, 219, 555, 744, 1054, 1231, 2601, 2333, 2720, 2538, 2599, 1967, 2600,
+    2825, 1911, 2098, 2972, 2983, 2988, 3504, 3555, 3670, 1888, 3444, 2537, 3524, 3439, 2938, 3287,
+    3370, 3089, 3124, 2123, 2124, 983, 2584, 2692, 190, 191, 1521, 2073, 701, 974, 470, 2883,
+    3768, 1359, 1948, 921, 922, 923, 924, 925, 926, 458, 920, 1420, 1604, 3188, 2235, 3393,
+    3722, 1130, 452, 502, 2517, 2182, 2778, 2125, 2126, 3118, 2243, 2242, 2933, 1632, 1623, 2381,
+    1603, 1145, 3037, 2101, 2904, 3281, 1822, 1823, 1202, 1203, 2528, 3824, 2208, 3260, 154, 155,
+    156, 157, 158, 1771, 3204, 3203, 2435, 1561, 3243, 14, 15, 16, 1872, 2905, 3032, 3003,
+    3019, 2994, 2986, 3455, 674, 1478, 1479, 1480, 1481, 3529, 3528, 1092, 1093, 2094, 2112, 2148,
+    2682, 3774, 3255, 2070, 1494, 931, 932, 2069, 386, 3305, 2908, 2906, 3139, 2892, 30, 1682,
+    2563, 890, 497, 498, 2657, 3724, 3463, 3495, 2015, 1964, 1952, 1926, 1940, 2279, 3437, 39,
+    2002, 2498, 1908, 959, 960, 961, 2150, 342, 2650, 2810, 1245, 95, 346, 2110, 617, 1898,
+    2035, 2610, 2034, 2149, 2881, 2880, 2790, 3779, 2, 1920, 2274, 2273, 443, 444, 445, 1684,
+    3063, 3350, 206, 3681, 3200, 1996, 2936, 3181, 2522, 3121, 3199, 746, 2067, 3194, 747, 748,
+    749, 1024, 2258, 3430, 3137, 506, 3302, 1694, 472, 3070, 2934, 1547, 1641, 2057, 478, 479,
+    480, 481, 3688, 1837, 2241, 3320, 3098, 2902, 3362, 1925, 2093, 1409, 2252, 208, 1004, 1973,
+    473, 2354, 3033, 3076, 1693, 3651, 2867, 1439, 2497, 2963, 2043, 2209, 2424, 91, 92, 600,
+    601, 2408, 337, 687, 688, 1551, 3311, 2799, 2156, 2157, 2158, 2159, 2160, 3356, 456, 1120,
+    997, 389, 390, 391, 2276, 1053, 1573, 2511, 1179, 1781, 2436, 2708, 1112, 2574, 3115, 2932,
+    3224, 2087, 3699, 2917, 1795, 2714, 3056, 675, 2523, 3517, 2357, 3208, 358, 2702, 225, 1126,
+    2302, 2221, 1181, 1595, 3513, 754, 1217, 2653, 623, 624, 1104, 3342, 2442, 3211, 195, 2582,
+    742, 743, 735, 736, 737, 738, 739, 740, 741, 3464, 1277, 3061, 321, 322, 323, 3355,
+    1129, 2180, 2989, 3198, 3700, 3811, 2477, 2326, 682, 2713, 1887, 2080, 1225, 2643, 1977, 2299,
+    3182, 1767, 1635, 1636, 1643, 1673, 3616, 3307, 538, 539, 540, 541, 542, 2876, 1278, 1417,
+    1994, 1212, 2900, 792, 816, 2431, 2430, 2874, 2863, 1338, 513, 514, 515, 976, 2228, 2229,
+    2230, 2216, 593, 309, 310, 3403, 3406, 3135, 2873, 2777, 2092, 3266, 1919, 2085, 2084, 819,
+    1630, 1631, 28, 2921, 2403, 1201, 1188, 563, 564, 565, 3675, 3788, 2918, 3304, 3702, 3177,
+    1597, 998, 3599, 2549, 660, 661, 1687, 1688, 1689, 3041, 2056, 2004, 2304, 2387, 2491, 258,
+    259, 260, 2502, 2524, 1157, 2053, 153, 159, 160, 1839, 3085, 3215, 2630, 1357, 1268, 1440,
+    2468, 3340, 2748, 394, 395, 2501, 2171, 3466, 871, 872, 223, 2470, 2984, 296, 297, 298,
+    299, 2344, 1142, 1143, 122, 123, 1722, 1723, 1724, 2505, 1710, 2800, 2860, 3147, 765, 1035,
+    1734, 2691, 703, 891, 892, 893, 3709, 86, 464, 465, 466, 1516, 2987, 2402, 2476, 1099,
+    477, 689, 849, 1003, 1105, 1221, 1609, 455, 3793, 2644, 3231, 3436, 3441, 3353, 32, 2594,
+    3754, 2480, 2031, 842, 677, 324, 3820, 2191, 2192, 2351, 2827, 2102, 2507, 3166, 3364, 3549,
+    1005, 2328, 3458, 2941, 3371, 523, 1064, 2837, 1983, 1514, 499, 500, 501, 3657, 3116, 3748,
+    3365, 3102, 3104, 3579, 121, 2828, 3532, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835,
+    2553, 700, 311, 2753, 2393, 1085, 2730, 3080, 3715, 812, 840, 2466, 1070, 1071, 1072, 3481,
+    1249, 2667, 2212, 450, 451, 2363, 3150, 3493, 2167, 1161, 1162, 1164, 794, 795, 784, 1250,
+    2478, 1269, 2573, 668, 1985, 2700, 2213, 1242, 1087, 2090, 3664, 764, 26, 2186, 2166, 2075,
+    2074, 2820, 347, 196, 197, 198, 59, 2303, 1351, 1352, 1646, 1123, 2291, 1855, 2207, 2957,
+    188, 2245, 3494, 3294, 823, 2930, 630, 1929, 287, 288, 289, 3227, 518, 519, 520, 1924,
+    843, 3631, 3617, 2922, 396, 397, 398, 399, 2953, 2698, 3000, 2868, 3400, 2832, 3143, 2088,
+    3472, 1959, 2786, 2787, 3075, 9, 3310, 1149, 962, 963, 964, 3293, 969, 970, 971, 972,
+    1598, 2911, 2909, 1602, 192, 193, 1151, 1152, 1608, 3531, 933, 934, 1429, 2294, 1690, 603,
+    604, 2703, 2949, 2083, 3679, 1691, 663, 548, 549, 2064, 2699, 2671, 796, 1882, 3542, 1393,
+    139, 1889, 625, 1235, 432, 2681, 3419, 2898, 2196, 1915, 981, 980, 3572, 433, 2520, 2519,
+    3787, 1954, 2741, 3386, 3433, 381, 3414, 3498, 1914, 3173, 256, 622, 1962, 1963, 3361, 2458,
+    904, 905, 906, 907, 3560, 3009, 1906, 1905, 420, 421, 419, 628, 284, 3180, 2434, 295,
+    1870, 2942, 1156, 3193, 2206, 516, 517, 3299, 1114, 1115, 268, 269, 270, 1662, 3283, 3282,
+    633, 634, 635, 636, 3149, 3145, 3561, 957, 757, 973, 3734, 2673, 1079, 3330, 3232, 407,
+    408, 2215, 3600, 860, 1936, 294, 2406, 2914, 1750, 1751, 1752, 2612, 3712, 1982, 2978, 559,
+    1298, 1377, 1628, 3050, 3727, 3795, 1349, 1350, 1778, 2140, 1032, 60, 61, 1033, 62, 2428,
+    3459, 2789, 2604, 1668, 605, 2550, 3698, 2288, 3649, 2412, 1259, 3251, 609, 1885, 2232, 2231,
+    2469, 3057, 3730, 3263, 621, 2001, 2233, 2438, 2869, 3257, 2931, 2076, 3535, 3468, 3536, 2314,
+    3376, 2973, 3534, 1825, 2661, 2659, 1718, 670, 669, 2727, 449, 130, 131, 3216, 984, 2694,
+    3108, 3530, 3716, 1798, 1791, 3503, 3556, 2264, 2944, 1160, 2974, 2744, 3206, 1586, 2189, 3673,
+    3803, 3802, 285, 286, 1677, 1793, 2219, 2450, 1515, 438, 439, 1497, 2306, 1307, 1344, 1458,
+    1148, 589, 590, 591, 592, 2063, 2062, 1467, 1466, 2608, 2618, 2797, 3520, 2465, 2464, 3161,
+    3241, 1541, 3286, 3250, 1302, 2444, 2443, 2425, 2312, 2767, 222, 3723, 1776, 3807, 2821, 3496,
+    273, 2127, 172, 173, 711, 2401, 2811, 1838, 3100, 3099, 2916, 1787, 789, 790, 791, 1396,
+    3744, 2433, 745, 3219, 3218, 3559, 3804, 1273, 1562, 1552, 1574, 1587, 3029, 3030, 762, 3630,
+    2872, 1715, 2295, 3743, 3418, 1176, 825, 3317, 2358, 3548, 767, 3228, 1378, 1379, 2742, 3454,
+    2038, 2236, 3196, 2521, 1672, 3190, 72, 1649, 1868, 2617, 1897, 2586, 2606, 1664, 1665, 1663,
+    3610, 2037, 2554, 2585, 827, 826, 556, 557, 558, 602, 1803, 3801, 1607, 277, 279, 280,
+    281, 282, 283, 2456, 2455, 2248, 2640, 194, 3004, 619, 620, 1720, 2705, 83, 84, 85,
+    1297, 900, 901, 902, 903, 1605, 1599, 662, 340, 3786, 763, 651, 652, 653, 654, 459,
+    1022, 2286, 2097, 3081, 1326, 1327, 25, 3731, 2061, 78, 1857, 1674, 70, 1002, 1836, 1471,
+    1472, 1473, 1474, 1475, 1476, 1477, 1470, 1847, 1848, 1774, 2761, 2355, 1082, 2199, 2301, 1746,
+    2461, 2418, 2417, 2427, 881, 1877, 1158, 1159, 759, 1177, 1563, 2510, 1418, 1658, 2474, 1423,
+    3394, 1300, 1301, 3776, 2540, 3822, 3775, 2292, 2486, 2453, 3629, 1843, 3749, 1279, 3036, 2670,
+    3435, 2638, 2985, 2845, 1006, 1007, 2826, 2131, 2211, 946, 947, 948, 949, 3212, 953, 954,
+    955, 943, 3426, 3427, 3015, 2008, 3144, 3373, 3460, 3475, 991, 1753, 1988, 1989, 1611, 1612,
+    8, 3735, 2244, 1482, 1483, 1484, 1485, 3296, 3295, 2217, 824, 230, 3017, 3027, 3028, 3169,
+    3153, 3068, 1356, 2337, 594, 595, 3245, 3244, 705, 3551, 2576, 2648, 2566, 1270, 2188, 2532,
+    2531, 3821, 57, 58, 3411, 1314, 1567, 1568, 1569, 1570, 1571, 344, 2749, 3809, 2373, 3622,
+    569, 1530, 174, 175, 3221, 3222, 3469, 988, 1013, 2572, 1167, 869, 870, 667, 1489, 2048,
+    2556, 1194, 3405, 1014, 2780, 3192, 3195, 2806, 2569, 2568, 3642, 3271, 3270, 3639, 1097, 3130,
+    3543, 1683, 3506, 2496, 44, 293, 3319, 49, 3315, 3112, 2352, 2265, 3083, 1265, 2005, 3828,
+    1797, 2632, 2846, 2631, 331, 1884, 3813, 1555, 3395, 2655, 3627, 1394, 1993, 1765, 1861, 1862,
+    1863, 2492, 1182, 96, 3229, 21, 3117, 3613, 2026, 2518, 2025, 3249, 3490, 3489, 3024, 3021,
+    3022, 1424, 1425, 1426, 2835, 3391, 1299, 2646, 2947, 2287, 3479, 3478, 1118, 2289, 214, 215,
+    3423, 211, 213, 212, 2581, 2249, 2285, 2284, 1626, 3604, 1543, 1384, 1385, 36, 2977, 3378,
+    3379, 3380, 3526, 3331, 2793, 2818, 3541, 3540, 3480, 1619, 985, 2816, 3246, 265, 261, 262,
+    263, 264, 266, 267, 1878, 1572, 1027, 1565, 1028, 1566, 1029, 1030, 1224, 2349, 3183, 3122,
+    560, 561, 562, 2794, 2823, 3641, 2042, 779, 780, 33, 2375, 3448, 2686, 2684, 2597, 2542,
+    3729, 2690, 3449, 2669, 1826, 2016, 2534, 2792, 3747, 1308, 1309, 2817, 2282, 1806, 851, 852,
+    2495, 2494, 817, 2545, 71, 2907, 2263, 2347, 97, 98, 3106, 2383, 3714, 1809, 13, 710,
+    3609, 3570, 1499, 1942, 3008, 2884, 2756, 2757, 2680, 2564, 3562, 3571, 822, 2535, 2885, 42,
+    1051, 3351, 1107, 2652, 3381, 3589, 3382, 3590, 3383, 3591, 3592, 3593, 1558, 2956, 698, 699,
+    1236, 829, 944, 945, 2783, 2784, 2785, 3273, 2822, 3705, 2891, 3671, 3209, 3053, 1303, 2116,
+    2452, 2415, 731, 1760, 45, 46, 3324, 3325, 1527, 3039, 1701, 1875, 3235, 3359, 3360, 801,
+    802, 3339, 12, 3073, 2129, 3638, 3052, 2108, 3322, 3323, 1526, 1874, 1074, 673, 1488, 2723,
+    1784, 2560, 1588, 1589, 1590, 1223, 3404, 940, 3146, 2893, 402, 401, 1369, 1370, 2254, 1058,
+    2728, 1098, 2796, 3525, 2726, 2620, 2627, 3539, 2763, 3614, 3778, 3777, 99, 100, 1610, 835,
+    1419, 2764, 1313, 3792, 349, 3596, 3597, 3598, 3656, 3553, 3552, 2181, 2169, 152, 3708, 3676,
+    2335, 2770, 2503, 2912, 3741, 47, 48, 2060, 2036, 2317, 2499, 1669, 2965, 586, 587, 3040,
+    2628, 1392, 2850, 2527, 950, 951, 952, 427, 428, 429, 430, 431, 426, 367, 1386, 2255,
+    671, 93, 94, 1817, 2020, 2391, 2750, 24, 1749, 2514, 1799, 798, 1802, 2645, 1660, 2290,
+    1260, 3773, 1584, 1585, 2260, 2509, 2508, 1858, 1761, 614, 615, 424, 3214, 3154, 3685, 1904,
+    3160, 2280, 2515, 598, 599, 2668, 2634, 3453, 2591, 2590, 3155, 3770, 3769, 2773, 914, 135,
+    136, 137, 2065, 3125, 3126, 3127, 2710, 3014, 1000, 1113, 79, 80, 81, 82, 2795, 2651,
+    1999, 88, 3313, 3314, 2390, 3306, 3248, 3766, 1748, 2091, 3799, 2318, 2473, 2840, 2841, 2842,
+    2843, 2844, 1883, 2864, 3573, 1263, 2134, 1578, 3348, 3760, 3049, 3095, 3668, 3185, 672, 1283,
+    1364, 1284, 1365, 1285, 1366, 1363, 2222, 1819, 1896, 3476, 126, 127, 128, 129, 1144, 3088,
+    2277, 3519, 3518, 3677, 1652, 1653, 1654, 1655, 1651, 1226, 1227, 3594, 3574, 1175, 89, 90,
+    509, 510, 1262, 2626, 1772, 2052, 2051, 202, 2709, 2234, 3058, 2954, 2940, 2624, 1310, 2184,
+    3276, 1991, 702, 3186, 3392, 2715, 2115, 1821, 3751, 3750, 2888, 3726, 3595, 3006, 3516, 807,
+    2055, 2054, 2616, 2615, 3005, 1620, 204, 3252, 1166, 1618, 3007, 3046, 2765, 2847, 3111, 2422,
+    2239, 3825, 3051, 1495, 1050, 2423, 2592, 3109, 2901, 1922, 2706, 3789, 785, 1010, 786, 1011,
+    1503, 2754, 2621, 3055, 1015, 1016, 1625, 3318, 1255, 3607, 3628, 2622, 2386, 1910, 2704, 132,
+    2270, 1272, 10, 11, 1, 1743, 2490, 3374, 1288, 1289, 357, 3462, 2377, 873, 874, 875,
+    876, 877, 878, 879, 880, 3507, 3694, 3761, 3110, 1974, 1553, 2155, 2976, 2664, 2449, 2332,
+    3710, 2660, 1731, 1732, 1733, 797, 1785, 3718, 3563, 3829, 3415, 1443, 1444, 1445, 1446, 348,
+    454, 1057, 1106, 1198, 1348, 1500, 1519, 1542, 1600, 1634, 1706, 1892, 1932, 2010, 2103, 2353,
+    2392, 2662, 2801, 2855, 2997, 3012, 3065, 3087, 3170, 3349, 3398, 3424, 3575, 3626, 3654, 1981,
+    2854, 2683, 1125, 781, 1442, 2807, 73, 74, 75, 76, 19, 453, 676, 836, 1122, 1193,
+    2732, 177, 179, 178, 176, 2138, 1055, 1056, 110, 111, 3581, 3582, 573, 574, 2426, 3357,
+    1903, 101, 1185, 1773, 34, 1576, 1577, 2146, 664, 665, 666, 3697, 2368, 3284, 2152, 3819,
+    2882, 1048, 1049, 1593, 1594, 486, 575, 576, 577, 578, 3230, 1721, 409, 410, 3272, 1813,
+    3658, 1582, 1583, 1075, 2384, 2044, 1305, 1647, 2979, 2915, 2079, 2086, 1306, 1811, 1316, 1317,
+    1318, 1319, 55, 1766, 978, 773, 774, 775, 2364, 566, 567, 568, 649, 650, 1324, 1325,
+    3445, 3647, 114, 115, 2565, 231, 232, 3717, 2330, 1163, 850, 908, 909, 910, 911, 912,
+    913, 220, 3289, 2021, 2530, 3758, 1804, 2266, 2460, 2541, 2262, 2838, 141, 2557, 3059, 861,
+    3238, 3128, 655, 2362, 3471, 2485, 1695, 1696, 1697, 1900, 2153, 360, 3637, 3090, 3511, 1928,
+    1780, 1946, 2814, 1768, 3660, 1700, 238, 239, 240, 241, 242, 2095, 1124, 1648, 1998, 2278,
+    2319, 2448, 1189, 2327, 2562, 658, 659, 2815, 7, 2559, 2558, 3138, 2746, 1215, 3806, 3092,
+    2437, 3763, 3762, 3443, 112, 113, 3165, 2960, 2058, 1127, 2457, 2489, 3452, 2068, 2831, 2830,
+    882, 1068, 1069, 1137, 1138, 1067, 1992, 3011, 551, 552, 553, 554, 422, 423, 3389, 2675,
+    2544, 2404, 312, 1740, 3047, 2268, 2104, 2361, 2772, 1931, 1606, 3764, 3508, 3412, 758, 2223,
+    22, 2992, 2966, 436, 437, 535, 536, 3086, 626, 627, 3401, 3402, 526, 2733, 3060, 105,
+    102, 107, 103, 104, 106, 2370, 2583, 3298, 2027, 1869, 3482, 713, 714, 715, 1969, 1970,
+    1150, 3048, 987, 380, 3432, 3141, 3140, 3686, 3488, 2677, 3119, 2247, 3020, 2813, 1680, 1681,
+    1965, 2396, 2380, 2809, 3187, 345, 2589, 2804, 2856, 474, 475, 3148, 646, 647, 2853, 1637,
+    916, 899, 216, 217, 537, 730, 1036, 1206, 3234, 3233, 3291, 491, 1842, 2724, 350, 2011,
+    1930, 2237, 1941, 2238, 2389, 2899, 3205, 1841, 3659, 1228, 1229, 1230, 1856, 2251, 2313, 2348,
+    2593, 2697, 3239, 3367, 3485, 3505, 3523, 3554, 460, 2151, 2397, 1702, 683, 684, 685, 686,
+    618, 3290, 2852, 3372, 2725, 2824, 3343, 3692, 3107, 3474, 1810, 1616, 2281, 2475, 38, 361,
+    3646, 1927, 356, 3619, 2575, 1267, 3633, 3634, 3635, 77, 1564, 1661, 2500, 3156, 1852, 3711,
+    2405, 2484, 1171, 1172, 1173, 1979, 3470, 3461, 2605, 3337, 189, 2731, 629, 1395, 2839, 818,
+    1020, 1021, 1232, 1233, 1234, 3690, 2696, 383, 917, 384, 918, 919, 2195, 325, 326, 2200,
+    3577, 766, 168, 3261, 1966, 2642, 2147, 1076, 1077, 3016, 3338, 2674, 2812, 2246, 2379, 2819,
+    2308, 414, 1670, 1972, 2445, 1893, 1679, 1180, 1468, 2340, 3425, 2030, 2029, 1917, 2539, 3620,
+    1216, 2739, 1457, 2421, 3611, 2451, 3420, 1864, 1865, 3256, 3158, 3159, 821, 884, 885, 2141,
+    2420, 1955, 2250, 2865, 3612, 3621, 2747, 63, 2529, 1621, 1169, 1170, 527, 528, 529, 3680,
+    994, 2975, 1241, 2173, 2174, 2175, 2176, 2177, 2178, 1243, 1849, 1850, 3335, 1132, 290, 291,
+    413, 977, 2454, 3640, 1633, 1498, 1953, 3783, 2887, 783, 1491, 1281, 1741, 1739, 3601, 3666,
+    2183, 3796, 2636, 2991, 1816, 1109, 1110, 3396, 1374, 2269, 3074, 1747, 23, 1879, 1866, 2471,
+    1699, 2654, 2639, 3428, 3429, 1493, 1034, 2722, 1728, 1729, 2388, 2910, 2769, 3042, 1066, 1801,
+    405, 406, 3576, 1579, 2718, 3794, 2096, 2467, 2955, 1422, 6, 3510, 3509, 1421, 1100, 1295,
+    2771, 3071, 2971, 3584, 3585, 2737, 3655, 2711, 1627, 722, 723, 724, 725, 726, 727, 3176,
+    1490, 3346, 2808, 2298, 3054, 3521, 3369, 1945, 3094, 3421, 3093, 332, 333, 334, 335, 336,
+    3151, 1528, 3268, 3262, 2082, 2614, 3113, 1517, 1518, 1266, 1820, 56, 2136, 2866, 588, 1529,
+    1943, 1944, 3, 1042, 530, 531, 532, 1975, 3701, 3123, 3465, 3586, 3587, 3588, 4, 678,
+    3326, 3327, 1101, 1252, 3237, 1708, 1073, 144, 3309, 2446, 3652, 834, 2596, 3785, 2329, 3625,
+    1214, 2548, 3446, 2339, 2561, 2369, 3264, 418, 1786, 3142, 1246, 1375, 657, 3129, 3737, 935,
+    936, 1213, 2385, 992, 2350, 2533, 3220, 2595, 120, 387, 388, 359, 1119, 3172, 3667, 2081,
+    2023, 1559, 1560, 3450, 140, 3332, 3545, 3096, 1666, 1667, 1890, 2836, 1984, 3259, 3258, 2745,
+    2463, 3704, 1448, 1449, 1450, 236, 3066, 108, 109, 1251, 3168, 2045, 1168, 2647, 3067, 1353,
+    1354, 1355, 327, 328, 329, 330, 782, 1447, 2336, 3501, 3114, 3132, 1716, 3740, 187, 180,
+    181, 182, 183, 184, 185, 186, 3691, 1725, 3808, 1735, 1736, 1737, 434, 435, 809, 810,
+    811, 3451, 3755, 3236, 728, 2805, 2779, 2762, 1025, 1026, 3162, 1909, 2998, 3136, 3558, 927,
+    928, 929, 930, 1524, 3069, 3223, 2382, 3544, 3827, 2967, 2201, 750, 751, 752, 753, 3018,
+    2543, 3201, 2323, 1121, 2678, 3134, 3682, 3707, 1947, 2028, 3133, 3683, 2407, 3771, 1139, 1339,
+    833, 3502, 1008, 1009, 3078, 2834, 2999, 2506, 2071, 3084, 656, 1800, 2256, 400, 1513, 2398,
+    1253, 1254, 1886, 1640, 50, 2857, 2858, 2802, 2293, 915, 1031, 3174, 2261, 2259, 363, 364,
+    365, 366, 362, 205, 467, 468, 469, 993, 1296, 228, 2356, 463, 712, 956, 1017, 1140,
+    2735, 3341, 229, 3278, 2555, 3354, 2721, 3557, 1367, 1368, 606, 607, 608, 1501, 1918, 2895,
+    1187, 417, 3038, 1078, 2447, 138, 1128, 2939, 3023, 2220, 965, 966, 967, 2194, 2968, 3384,
+    2257, 1407, 1408, 1907, 3242, 3765, 1769, 2272, 2374, 2679, 2982, 3240, 3368, 3486, 3533, 3568,
+    1012, 1219, 1548, 1549, 1550, 1880, 2687, 616, 1205, 1933, 1738, 119, 2413, 3064, 118, 793,
+    3644, 3434, 3725, 52, 2198, 2114, 2685, 1463, 1951, 2113, 343, 2117, 2118, 2526, 3001, 2926,
+    2925, 2154, 1987, 679, 680, 681, 3477, 446, 447, 448, 3814, 1117, 1347, 2099, 1358, 1346,
+    1328, 1536, 1556, 1557, 3344, 234, 235, 2920, 3207, 3416, 3618, 3810, 64, 65, 66, 67,
+    3757, 3782, 3103, 2185, 886, 2170, 2755, 2927, 1719, 2743, 982, 3101, 353, 1247, 2598, 3279,
+    2179, 3580, 3483, 3583, 1815, 3615, 1496, 0, 1779, 351, 3497, 1292, 1293, 1294, 2372, 941,
+    942, 3265, 2267, 3687, 1345, 300, 301, 302, 303, 304, 1642, 2366, 2552, 1575, 2050, 1431,
+    1432, 1433, 1452, 1453, 3812, 690, 691, 692, 693, 694, 2307, 1059, 2111, 3072, 2623, 3267,
+    2014, 2109, 1730, 3363, 1871, 2551, 1103, 2172, 695, 696, 697, 1644, 209, 1343, 1428, 338,
+    339, 27, 803, 31, 3784, 3269, 2214, 3665, 3522, 3366, 278, 1763, 1094, 1712, 1546, 315,
+    316, 317, 318, 319, 320, 3473, 1387, 1388, 2142, 2571, 2656, 1329, 1330, 1331, 839, 1086,
+    1469, 2338, 2829, 631, 1645, 1851, 968, 1108, 1505, 1638, 1685, 1506, 1639, 1686, 250, 1207,
+    251, 1208, 252, 1209, 253, 1210, 1211, 254, 255, 2525, 2607, 116, 117, 1978, 2791, 838,
+    3624, 3733, 2137, 2758, 2759, 1507, 596, 597, 2226, 2877, 3781, 355, 3397, 3815, 354, 382,
+    200, 201, 3387, 1902, 494, 1174, 227, 3669, 1186, 2633, 243, 244, 245, 246, 247, 248,
+    249, 352, 3292, 2300, 1081, 2611, 828, 2964, 3390, 1274, 20, 1486, 1487, 1867, 2077, 1264,
+    3175, 3456, 2019, 2570, 2218, 2164, 1052, 1675, 1504, 3605, 3606, 143, 1184, 894, 895, 896,
+    897, 898, 2649, 3696, 2378, 2740, 990, 3661, 2007, 853, 813, 814, 854, 1083, 1084, 68,
+    579, 1237, 1844, 2751, 3431, 3438, 2536, 1287, 142, 1460, 1461, 1522, 415, 416, 404, 1596,
+    2658, 855, 856, 857, 858, 859, 1389, 1390, 1391, 3347, 1814, 2227, 1502, 2410, 3569, 2345,
+    3636, 1455, 1454, 1436, 3672, 2072, 1986, 2315, 3377, 3742, 1523, 3308, 2365, 3303, 3797, 161,
+    162, 163, 164, 2924, 1845, 2119, 2120, 2121, 1218, 1976, 2894, 2441, 1624, 3275, 3565, 1949,
+    1950, 3062, 292, 2024, 482, 483, 484, 485, 3695, 1336, 1337, 524, 1360, 1361, 1362, 3791,
+    3790, 2371, 17, 18, 863, 862, 864, 2776, 2224, 1671, 2929, 203, 2003, 403, 2193, 776,
+    777, 778, 3684, 768, 2100, 3632, 1613, 1614, 1615, 1096, 1291, 1280, 1304, 1315, 3163, 648,
+    645, 148, 149, 150, 1934, 2310, 2309, 3035, 3447, 1200, 2736, 2429, 3678, 3408, 3409, 760,
+    761, 1133, 1332, 1134, 1333, 1334, 1335, 1147, 1846, 2022, 2130, 2165, 1591, 1592, 1745, 1840,
+    3385, 1622, 2459, 1509, 1792, 3077, 3564, 3602, 3603, 550, 1968, 831, 2666, 3491, 3321, 2225,
+    2923, 2990, 2133, 151, 832, 1382, 1383, 1381, 2009, 3179, 3178, 2862, 2861, 2619, 1676, 272,
+    570, 571, 572, 1199, 1808, 2970, 2969, 1240, 2981, 2980, 1192, 1311, 1312, 1061, 1062, 1063,
+    3780, 3693, 1956, 3043, 2145, 2493, 1248, 3044, 3045, 2139, 3002, 2275, 3643, 3285, 1754, 1755,
+    1756, 1757, 1758, 1759, 3746, 1380, 2913, 1095, 2567, 2187, 847, 2919, 1805, 1065, 1088, 3407,
+    2135, 1617, 2849, 1540, 2937, 2603, 2602, 2399, 3650, 3713, 1901, 2394, 2395, 3417, 54, 53,
+    3736, 2803, 3578, 3013, 2719, 3288, 3830, 425, 1342, 1692, 2376, 1650, 1796, 1089, 1090, 133,
+    134, 169, 170, 171, 2935, 2359, 3623, 1535, 1153, 1154, 1155, 1744, 1044, 1045, 1043, 2440,
+    805, 806, 2688, 2143, 2577, 3010, 2316, 1320, 729, 975, 3467, 3167, 3537, 1544, 1783, 40,
+    41, 3399, 1464, 1465, 3388, 1434, 1435, 1601, 2078, 3538, 1508, 2752, 1703, 2325, 2105, 2106,
+    1554, 1178, 1220, 1441, 2943, 1204, 3375, 2609, 29, 1019, 3253, 237, 1794, 2205, 3025, 3026,
+    986, 1018, 1921, 1818, 2046, 2712, 3547, 3546, 2663, 2253, 378, 379, 1238, 1629, 507, 508,
+    1340, 1705, 1859, 1860, 3171, 1853, 2676, 2766, 1913, 1912, 313, 314, 1037, 989, 1080, 2049,
+    3164, 1916, 1782, 3567, 3566, 3300, 1371, 1372, 1373, 2729, 2946, 2945, 2367, 3202, 1891, 1881,
+    3034, 1707, 199, 1437, 1438, 1459, 392, 393, 257, 2162, 1239, 226, 2587, 837, 1895, 1894,
+    3152, 2322, 3336, 1257, 2547, 2546, 1876, 3352, 2788, 2089, 1713, 1714, 2897, 2896, 3662, 3663,
+    306, 307, 305, 490, 2040, 2039, 2411, 2579, 2578, 3484, 2903, 999, 1286, 3225, 1256, 2168,
+    845, 846, 844, 2781, 2782, 461, 462, 1873, 2768, 2479, 3422, 3226, 3457, 2414, 3213, 2012,
+    492, 493, 2833, 1321, 1322, 1323, 1935, 3500, 3499, 3674, 2890, 2889, 210, 958, 2641, 632,
+    505, 3689, 1290, 2197, 233, 2066, 1001, 2324, 637, 638, 639, 640, 641, 642, 643, 644,
+    2203, 1261, 1659, 887, 888, 889, 1997, 883, 3527, 3648, 2360, 2343, 308, 3608, 3358, 2297,
+    2296, 3732, 3082, 1938, 1939, 2928, 3645, 2462, 1060, 69, 1937, 3328, 3329, 3752, 2320, 2321,
+    547, 3184, 3653, 1131, 2013, 224, 2689, 2952, 2334, 2665, 543, 544, 545, 546, 2047, 865,
+    866, 867, 868, 3097, 1512, 1698, 1711, 1727, 1116, 2996, 3720, 3739, 3312, 43, 1146, 1923,
+    2948, 2439, 3079, 3515, 799, 800, 37, 1990, 2734, 35, 2041, 2512, 2851, 87, 1111, 848,
+    1135, 1136, 808, 2951, 2516, 2331, 1023, 3800, 3210, 820, 3191, 2128, 1282, 2346, 2487, 2716,
+    3301, 841, 1770, 1971, 1709, 3274, 1165,
+};
+
+#endif // LOCATION_INDEX_H
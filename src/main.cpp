@@ -9,10 +9,19 @@
 #include <Adafruit_SSD1306.h>
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include <pgmspace.h>
 #include <float.h>
 
-#include "location.h"
+#include "fetch_sched.h"
+#include "frame_diff.h"
+#include "grid.h"
+#include "history_log.h"
+#include "obs_cache.h"
+#include "region.h"
+#include "time_series.h"
+#include "watchlist.h"
+#include "weather.h"
 
 // =============================
 // OLED 설정
@@ -20,10 +29,69 @@
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
 
+// I2C 한 번에 보내는 최대 바이트 (Wire 버퍼 크기, 앞의 0x40 한 바이트 포함)
+#ifdef I2C_BUFFER_LENGTH
+#define OLED_WIRE_MAX (I2C_BUFFER_LENGTH < 256 ? I2C_BUFFER_LENGTH : 256)
+#else
+#define OLED_WIRE_MAX 32
+#endif
+
+// 바뀐 부분만 보내는 SSD1306
+// 패널에 마지막으로 보낸 버퍼를 들고 있다가 displayChanged()에서 바뀐 페이지의 바뀐 열만 보낸다.
+// (가로 주소 모드에서 PAGEADDR/COLUMNADDR로 창을 정하면 데이터가 그 창만 채운다)
+class DirtySSD1306 : public Adafruit_SSD1306 {
+public:
+  explicit DirtySSD1306(TwoWire* twi) : Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, twi, -1) {}
+
+  // 전체를 보내고 보낸 내용을 기억한다.
+  void displayAll() {
+    display();
+    memcpy(shown, getBuffer(), sizeof(shown));
+    synced = true;
+  }
+
+  // 바뀐 곳만 보낸다. 보낸 데이터 바이트 수를 돌려준다.
+  int displayChanged() {
+    if (!synced) { displayAll(); return sizeof(shown); }
+
+    FrameSpan spans[SCREEN_HEIGHT / 8];
+    int n = frameDiff(buffer, shown, SCREEN_WIDTH, SCREEN_HEIGHT / 8, spans);
+    if (n == 0) return 0;
+
+    int sent = 0;
+    wire->setClock(wireClk);
+    for (int i = 0; i < n; i++) {
+      const FrameSpan& sp = spans[i];
+      const uint8_t window[] = { SSD1306_PAGEADDR, sp.page, sp.page,
+                                 SSD1306_COLUMNADDR, sp.first, sp.last };
+      ssd1306_commandList(window, sizeof(window));
+
+      int offset = sp.page * SCREEN_WIDTH + sp.first;
+      int len = sp.last - sp.first + 1;
+      for (int done = 0; done < len; ) {
+        int chunk = min(len - done, OLED_WIRE_MAX - 1);
+        wire->beginTransmission(i2caddr);
+        wire->write((uint8_t)0x40);
+        wire->write(buffer + offset + done, chunk);
+        wire->endTransmission();
+        done += chunk;
+      }
+      memcpy(shown + offset, buffer + offset, len);
+      sent += len;
+    }
+    wire->setClock(restoreClk);
+    return sent;
+  }
+
+private:
+  uint8_t shown[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+  bool synced = false;
+};
+
 // 메인 OLED (0x3C)
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
-// 그래프 OLED (0x3D)
-Adafruit_SSD1306 graphDisplay(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+// 그래프 OLED (0x3D), 바뀐 부분만 전송
+DirtySSD1306 graphDisplay(&Wire);
 
 // =============================
 // LED PIN 설정
@@ -36,6 +104,7 @@ Adafruit_SSD1306 graphDisplay(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
 // 버튼 PIN (그래프 모드 전환)
 // =============================
 #define BTN_PIN 33
+#define BTN_DEBOUNCE_MS 250
 int graphMode = 0;  // 0=temp, 1=humid, 2=rain, 3=wind
 
 // =============================
@@ -48,19 +117,29 @@ unsigned long lastDebounceTime = 0;
 unsigned long debounceDelay = 50; // 채터링 방지 (50ms)
 
 // =============================
-// 최근 12시간 그래프 데이터
+// 시간별 날씨 기록 (그래프는 최근 GRAPH_HOURS시간)
 // =============================
-float tempHistory[12];
-float humidHistory[12];
-float rainHistory[12];
-float windHistory[12];
+// HISTORY_HOURS: 화면 지역 기록을 몇 시간 들고 있을지 (24, 72, 168(1주) 등, 시간당 12 B)
+// 값은 PackedObs로 줄여서 저장한다 (weather.h)
+#ifndef HISTORY_HOURS
+#define HISTORY_HOURS 24
+#endif
+#define GRAPH_HOURS 12
+static_assert(GRAPH_HOURS <= HISTORY_HOURS && GRAPH_HOURS <= 16, "graph window must fit the history and a 16-bit mask");
+
+TimeSeries<PackedObs, HISTORY_HOURS> history;
+long historyNowHour = -1;  // 그래프 오른쪽 끝(현재) 시각, kmaHourIndex
 
 // -----------------------------
 // WiFi, API 설정
 // -----------------------------
 const char* ssid     = "Wokwi-GUEST";
 const char* password = "";
-const char* host    = "https://apihub.kma.go.kr";
+// KMA_HOST: 다른 서버로 요청 (예: -D KMA_HOST='"http://192.168.0.10:8080"', test/kma_stub 의 대체 서버)
+#ifndef KMA_HOST
+#define KMA_HOST "https://apihub.kma.go.kr"
+#endif
+const char* host    = KMA_HOST;
 const char* authKey = "wLWQLTOfRxC1kC0zn7cQ2g";
 
 const long  gmtOffset_sec      = 9 * 3600;
@@ -70,29 +149,6 @@ const char* ntpServer          = "pool.ntp.org";
 // Local Server URL (필요시 IP 수정)
 String serverUrl = "http://172.16.81.23:5000/location";
 
-// =============================
-// 기상청 격자 변환 상수 및 정의
-// =============================
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-#define RE 6371.00877 // 지구 반경(km)
-#define GRID 5.0      // 격자 간격(km)
-#define SLAT1 30.0    // 투영 위도1(degree)
-#define SLAT2 60.0    // 투영 위도2(degree)
-#define OLON 126.0    // 기준점 경도(degree)
-#define OLAT 38.0     // 기준점 위도(degree)
-#define XO 43         // 기준점 X좌표(GRID)
-#define YO 136        // 기준점 Y좌표(GRID)
-#define DEGRAD (M_PI / 180.0)
-
-// X, Y 좌표를 담을 구조체 정의
-typedef struct {
-    int x;
-    int y;
-} GridPoint;
-
 // 좌표 (초기값: 서울)
 int nx = 60;
 int ny = 127;
@@ -100,22 +156,77 @@ int ny = 127;
 // 현재 nx,ny에 대응하는 지역 이름 (OLED 표시용)
 String currentLocationName = "";
 
+// 이름 검색 후보 (시리얼에서 번호로 고를 때 사용)
+int suggestionRows[REGION_SUGGEST_MAX];
+int suggestionCount = 0;
+
 float myLat;
 float myLon;
 
+// 날씨 가져오기 작업(core 0) <-> loop() 큐
+struct FetchRequest {
+  uint32_t id;       // 스케줄러 세대 번호 (fetch_sched.h)
+  int nx;
+  int ny;
+  time_t now;        // 기준 시각 (7분 보정), 비트 k = now - k시간
+  int32_t nowHour;
+  uint16_t missing;  // 기록에 없는 시간만 받는다
+  bool loadLog;      // 받기 전에 플래시 로그에서 먼저 채운다 (격자가 바뀌었을 때)
+};
+
+struct FetchResult {
+  uint32_t id;
+  bool done;    // 요청 끝 (ok = WiFi 연결됨)
+  bool now;     // 현재 시간 값 (LED, 메인 OLED 갱신)
+  bool ok;
+  WeatherObs obs;
+  bool watch;   // 관심 지역 갱신 결과 (id 대신 nx, ny로 찾음)
+  bool forecast; // 실황이 아니라 단기예보 값 (HISTORY_FROM_FORECAST, 로그에 남기지 않음)
+  bool fromLog;  // 플래시 로그에서 읽은 값 (다시 로그에 남기지 않음)
+  uint8_t nx;
+  uint8_t ny;
+  int32_t hour; // kmaHourIndex
+};
+
+// 관심 지역 갱신 요청: 격자마다 빠진 시간만
+struct WatchRequest {
+  time_t now;     // 기준 시각 (7분 보정), 비트 k = now - k시간
+  int32_t nowHour;
+  uint8_t count;
+  uint8_t nx[WATCHLIST_SIZE];
+  uint8_t ny[WATCHLIST_SIZE];
+  uint16_t missing[WATCHLIST_SIZE];
+};
+
+QueueHandle_t fetchRequestQueue;  // 길이 1: 새 요청이 아직 시작 안 한 요청을 덮어쓴다
+QueueHandle_t fetchResultQueue;
+QueueHandle_t watchRequestQueue;  // 길이 1: 화면 지역 요청이 없을 때만 처리
+int fetchedNx = -1;               // 히스토리 배열이 담고 있는 격자
+int fetchedNy = -1;
+bool fetchFailed = false;         // 지금 세대에서 실패한 시간이 있는지 (있으면 다 받은 것으로 치지 않음)
+
+#define WATCHLIST_REFRESH_MS (10UL * 60UL * 1000UL)  // 관심 지역 갱신 주기
+unsigned long lastWatchRefresh = 0;
+
 // =============================
 // 함수 프로토타입 선언
 // =============================
-bool extractWeather(const String&, float&, float&, float&, float&, float&);
 void applyOutputs(float, float, float, float, float);
 void getWeatherHistory12h();
+void requestWatchRefresh();
+void printWatchlist();
+void pollWeatherResults();
+void fetchTask(void*);
+bool fetchNcst(HTTPClient& http, WiFiClient& client, int gx, int gy,
+               uint32_t baseDate, uint16_t baseTime, bool verbose, WeatherObs& obs);
+bool getObservation(HTTPClient& http, WiFiClient& client, int gx, int gy, time_t t,
+                    bool verbose, WeatherObs& obs);
+int fetchVilageFcst(HTTPClient& http, WiFiClient& client, int gx, int gy, time_t start,
+                    int hours, bool verbose, WeatherObs out[]);
 void drawGraph();
+void showGraph();
 GridPoint getLocation();
-GridPoint changeToXY(double lat, double lon);
-bool findXYByLocation(const char* inputName, int* outX, int* outY);
-bool findLocationNameByXY(int gx, int gy, String &outName);
-double getDistanceSquared(double lat1, double lon1, double lat2, double lon2);
-const char* findNearestRegion(int inputX, int inputY, double currentLat, double currentLon);
+void selectRegion(int row);
 
 // =============================
 // Setup
@@ -138,7 +249,7 @@ void setup() {
     while(1);
   }
   graphDisplay.clearDisplay();
-  graphDisplay.display();
+  graphDisplay.displayAll();
 
   pinMode(LED_RED, OUTPUT);
   pinMode(LED_YELLOW, OUTPUT);
@@ -146,13 +257,6 @@ void setup() {
   pinMode(BTN_PIN, INPUT_PULLUP);
   pinMode(BUTTON_PIN, INPUT_PULLUP);
 
-  for (int i = 0; i < 12; i++){
-    tempHistory[i]  = NAN;
-    humidHistory[i] = NAN;
-    rainHistory[i]  = NAN;
-    windHistory[i]  = NAN;
-  }
-
   Serial.println("=== ESP32 + KMA Weather (12h graph) ===");
   Serial.println("Enter grid nx ny (ex: 60 127) or Location Name.");
 
@@ -172,12 +276,30 @@ void setup() {
     delay(300);
   }
   Serial.println("Time synced.");
+
+  // 지난 관측 캐시 (OBS_CACHE_LITTLEFS 빌드면 플래시에서 읽어 옴)
+  obsCacheBegin();
+
+  // 날씨 가져오기는 core 0 작업에서 (loop는 core 1에서 계속 돈다)
+  fetchRequestQueue = xQueueCreate(1, sizeof(FetchRequest));
+  fetchResultQueue  = xQueueCreate(13, sizeof(FetchResult));
+  watchRequestQueue = xQueueCreate(1, sizeof(WatchRequest));
+  xTaskCreatePinnedToCore(fetchTask, "fetch", 12288, nullptr, 1, nullptr, 0);
 }
 
 // =============================
 // Loop
 // =============================
 void loop(){
+  // 0. 날씨 결과가 왔으면 반영 (HTTP는 fetchTask에서)
+  pollWeatherResults();
+
+  // 관심 지역은 정해진 주기로 한꺼번에 갱신
+  if (millis() - lastWatchRefresh >= WATCHLIST_REFRESH_MS) {
+    lastWatchRefresh = millis();
+    requestWatchRefresh();
+  }
+
   // 1. 현재 버튼 핀의 상태를 읽습니다.
   int reading = digitalRead(BUTTON_PIN);
 
@@ -262,12 +384,20 @@ void loop(){
             nx = newX;
             ny = newY;
 
-            // 좌표 → 지역명 찾아서 currentLocationName 갱신 (있으면)
+            // 좌표 → 지역명 찾아서 currentLocationName 갱신 (없으면 격자 중심에서 가장 가까운 지역)
             String locName;
             if (findLocationNameByXY(nx, ny, locName)){
               currentLocationName = locName;
             } else {
+              double cLat, cLon;
+              RegionMatch nearby[1];
+              changeToLatLon(nx, ny, &cLat, &cLon);
               currentLocationName = "";
+              if (findNearestRegions(cLat, cLon, 1, nearby) > 0){
+                char name[LOCATION_NAME_BUF];
+                getLocationName(nearby[0].row, name, sizeof(name));
+                currentLocationName = String("~") + name;
+              }
             }
 
             Serial.print("📌 New Grid (XY) -> ");
@@ -280,8 +410,34 @@ void loop(){
         }
       }
 
-      // 2) 숫자 좌표가 아니면 "지역 이름"으로 검색 (findXYByLocation 사용)
+      // 2) 직전 후보 목록이 있으면 한 자리 번호로 고르기
+      if(!handled && suggestionCount > 0 && line.length() == 1 && isDigit((unsigned char)line[0])){
+        int pick = line[0] - '1';
+        if (pick >= 0 && pick < suggestionCount) {
+          selectRegion(suggestionRows[pick]);
+          handled = true;
+        }
+      }
+
+      // 3) 관심 지역 명령: watch (목록), watch add / watch del (지금 격자 추가/삭제)
+      if(!handled && (line == "watch" || line == "watch add" || line == "watch del")){
+        if (line == "watch add") {
+          if (watchlistAdd(nx, ny) >= 0) {
+            Serial.printf("⭐ Watch + %d, %d\n", nx, ny);
+            requestWatchRefresh();
+          } else {
+            Serial.printf("⚠ Watchlist full (%d)\n", WATCHLIST_SIZE);
+          }
+        } else if (line == "watch del") {
+          if (watchlistRemove(nx, ny)) Serial.printf("⭐ Watch - %d, %d\n", nx, ny);
+        }
+        printWatchlist();
+        handled = true;
+      }
+
+      // 4) 숫자 좌표가 아니면 "지역 이름"으로 검색 (findXYByLocation 사용)
       if(!handled){
+        suggestionCount = 0;
         int gx, gy;
         if (findXYByLocation(line.c_str(), &gx, &gy)) {
           nx = gx;
@@ -293,197 +449,523 @@ void loop(){
           Serial.println(ny);
           getWeatherHistory12h();
         } else {
-          Serial.println("⚠ 지역 이름을 찾을 수 없습니다. (location.h 내용과 정확히 동일하게 입력)");
+          // 정확히 같은 이름이 없으면 단어 앞부분 / 오타 허용 검색
+          int rows[REGION_SUGGEST_MAX];
+          int count = suggestLocations(line.c_str(), rows, REGION_SUGGEST_MAX);
+          if (count == 1) {
+            selectRegion(rows[0]);
+          } else if (count > 1) {
+            Serial.println("🔎 비슷한 지역 (번호 입력):");
+            char name[LOCATION_NAME_BUF];
+            for (int i = 0; i < count; i++) {
+              getLocationName(rows[i], name, sizeof(name));
+              Serial.printf("  %d) %s\n", i + 1, name);
+              suggestionRows[i] = rows[i];
+            }
+            suggestionCount = count;
+          } else {
+            Serial.println("⚠ 지역 이름을 찾을 수 없습니다. (location.h 내용과 정확히 동일하게 입력)");
+          }
         }
       }
     }
   }
 
-  // 버튼 - 그래프 모드 전환
+  // 버튼 - 그래프 모드 전환 (그려 둔 화면으로 바꾸기만 함)
+  // 떨림은 BTN_DEBOUNCE_MS 안의 다음 눌림을 무시해서 거른다. (loop를 멈추지 않음)
   static int lastBtn = HIGH;
+  static unsigned long lastPressMs = 0;
   int nowBtn = digitalRead(BTN_PIN);
 
-  if(lastBtn == HIGH && nowBtn == LOW){
+  if(lastBtn == HIGH && nowBtn == LOW && millis() - lastPressMs >= BTN_DEBOUNCE_MS){
+    lastPressMs = millis();
     graphMode = (graphMode + 1) % 4;
     Serial.print("Graph mode -> ");
     if      (graphMode == 0) Serial.println("Temperature");
     else if (graphMode == 1) Serial.println("Humidity");
     else if (graphMode == 2) Serial.println("Rain (log)");
     else                     Serial.println("Wind");
-    drawGraph();
-    delay(250);
+    showGraph();
   }
 
   lastBtn = nowBtn;
 }
 
 // =============================
-// 12시간 데이터 가져오기
+// 검색으로 고른 지역으로 이동
 // =============================
-void getWeatherHistory12h() {
-  if (WiFi.status() != WL_CONNECTED) return;
-
-  struct tm ti;
-  getLocalTime(&ti);
-  time_t now = mktime(&ti);
+void selectRegion(int row) {
+  char name[LOCATION_NAME_BUF];
+  getLocationName(row, name, sizeof(name));
+  if (!findXYByLocation(name, &nx, &ny)) return;
+
+  suggestionCount = 0;
+  currentLocationName = name;
+  Serial.print("📌 New Grid (지역명) -> ");
+  Serial.print(name);
+  Serial.print(" : ");
+  Serial.print(nx);
+  Serial.print(", ");
+  Serial.println(ny);
+  getWeatherHistory12h();
+}
 
-  now -= 7 * 60;  // 7분 전 기준 (기상청 업데이트 딜레이 고려)
+// =============================
+// API GET (keep-alive)
+// =============================
+// client/http는 호출한 쪽에서 만든 것을 계속 써서 keep-alive 연결과 TLS 세션을 요청 사이에 재사용한다.
+// 200이면 본문을 String으로 모으지 않고 받는 대로 sink(파서)에 넘기고 true.
+static bool httpGetInto(HTTPClient& http, WiFiClient& client, const String& url,
+                        bool verbose, Stream& sink) {
+  // 서버가 keep-alive 연결을 닫았으면 GET이 음수 코드로 실패한다. 새 연결로 한 번만 다시 시도.
+  for (int attempt = 0; attempt < 2; attempt++) {
+    if (!http.begin(client, url)) return false;
+    int code = http.GET();
+    if (verbose) {
+      Serial.print("  HTTP code: ");
+      Serial.println(code);
+    }
+    if (code < 0) {
+      http.end();
+      client.stop();
+      continue;
+    }
 
-  Serial.println("\n=== Fetch 12h history ===");
+    bool ok = false;
+    if (code == 200) {
+      // 본문을 끝까지 읽어야 연결을 재사용할 수 있다 (writeToStream은 Content-Length/chunked 끝까지 읽음)
+      ok = http.writeToStream(&sink) >= 0;
+    }
+    http.end();                       // setReuse(true)이면 연결은 닫지 않는다
+    return ok;
+  }
+  return false;
+}
 
-  // 1) 현재(보정된 now) 먼저 가져와서 LED+OLED 갱신
-  {
-    struct tm* bt = localtime(&now);
+// time_t -> 요청용 base_date(YYYYMMDD), base_time(HH00)
+static void hourBaseOf(time_t t, uint32_t& baseDate, uint16_t& baseTime) {
+  struct tm* bt = localtime(&t);
+  baseDate = (uint32_t)(bt->tm_year + 1900) * 10000 + (bt->tm_mon + 1) * 100 + bt->tm_mday;
+  baseTime = (uint16_t)(bt->tm_hour * 100);  // 보정된 시각의 '시'만 사용해서 정각(HH00)으로 요청
+}
 
-    char baseDate[9];
-    sprintf(baseDate, "%04d%02d%02d",
-            bt->tm_year + 1900,
-            bt->tm_mon + 1,
-            bt->tm_mday);
+// 지금 받을 수 있는 가장 최근 관측 시각: 7분 전 기준 (기상청 업데이트 딜레이 고려)
+static long latestObsHour(time_t* now) {
+  *now = time(nullptr) - 7 * 60;
+  uint32_t d;
+  uint16_t h;
+  hourBaseOf(*now, d, h);
+  return kmaHourIndex(d, h);
+}
 
-    // 7분 보정된 시각의 '시'만 사용해서 정각(HH00)으로 요청
-    char baseTime[5];
-    sprintf(baseTime, "%02d00", bt->tm_hour);
+// =============================
+// 초단기실황 한 시간치 요청
+// =============================
+// base_date/base_time의 관측을 가져온다.
+bool fetchNcst(HTTPClient& http, WiFiClient& client, int gx, int gy,
+               uint32_t baseDate, uint16_t baseTime, bool verbose, WeatherObs& obs) {
+  char dateStr[9];
+  char timeStr[5];
+  sprintf(dateStr, "%08lu", (unsigned long)baseDate);
+  sprintf(timeStr, "%04u", (unsigned)baseTime);
+
+  String url = String(host) +
+    "/api/typ02/openApi/VilageFcstInfoService_2.0/getUltraSrtNcst"
+    "?authKey=" + authKey +
+    "&dataType=JSON"
+    "&numOfRows=60"
+    "&pageNo=1"
+    "&base_date=" + dateStr +
+    "&base_time=" + timeStr +
+    "&nx=" + gx +
+    "&ny=" + gy;
+
+  if (verbose) {
+    Serial.println("[Now] URL:");
+    Serial.println(url);
+  }
 
-    String url = String(host) +
-      "/api/typ02/openApi/VilageFcstInfoService_2.0/getUltraSrtNcst"
-      "?authKey=" + authKey +
-      "&dataType=JSON"
-      "&numOfRows=60"
-      "&pageNo=1"
-      "&base_date=" + baseDate +
-      "&base_time=" + baseTime +
-      "&nx=" + nx +
-      "&ny=" + ny;
+  NcstParser parser;
+  if (!httpGetInto(http, client, url, verbose, parser)) return false;
+  return parser.finish(obs);
+}
 
-    Serial.println("[Now] URL:");
+// =============================
+// 단기예보 여러 시간치를 한 번에 요청
+// =============================
+// start(정시로 내림)부터 hours시간치의 예보를 out에 채우고, 기온·습도가 있는 칸 수를 돌려준다.
+// 단기예보는 02, 05, ..., 23시에 발표되고 발표 1시간 뒤부터 들어 있으므로,
+// start보다 1시간 이상 앞선 가장 늦은 발표를 쓴다. (시간당 카테고리 12개 -> 최대 14시간 x 12 < 200)
+int fetchVilageFcst(HTTPClient& http, WiFiClient& client, int gx, int gy, time_t start,
+                    int hours, bool verbose, WeatherObs out[]) {
+  time_t issue = start - 3600;
+  struct tm* it = localtime(&issue);
+  issue -= ((it->tm_hour + 1) % 3) * 3600;   // 02, 05, ..., 23시로 내림
+
+  uint32_t baseDate, startDate;
+  uint16_t baseTime, startTime;
+  hourBaseOf(issue, baseDate, baseTime);
+  hourBaseOf(start, startDate, startTime);
+
+  char dateStr[9];
+  char timeStr[5];
+  sprintf(dateStr, "%08lu", (unsigned long)baseDate);
+  sprintf(timeStr, "%04u", (unsigned)baseTime);
+
+  String url = String(host) +
+    "/api/typ02/openApi/VilageFcstInfoService_2.0/getVilageFcst"
+    "?authKey=" + authKey +
+    "&dataType=JSON"
+    "&numOfRows=200"
+    "&pageNo=1"
+    "&base_date=" + dateStr +
+    "&base_time=" + timeStr +
+    "&nx=" + gx +
+    "&ny=" + gy;
+
+  if (verbose) {
+    Serial.println("[Fcst] URL:");
     Serial.println(url);
+  }
 
-    WiFiClientSecure client; client.setInsecure();
-    HTTPClient http;
-    if (http.begin(client, url)) {
-      int code = http.GET();
-      Serial.print("  HTTP code: ");
-      Serial.println(code);
-      if (code == 200) {
-        String js = http.getString();
-        float T, H, RN, W, VEC;
-        if (extractWeather(js, T, H, RN, W, VEC)) {
-          Serial.print("  Now T=");  Serial.print(T);
-          Serial.print("C, H=");     Serial.print(H);
-          Serial.print("%, RN=");    Serial.print(RN);
-          Serial.print("mm, W=");    Serial.print(W);
-          Serial.print("m/s, VEC=");
-          Serial.println(VEC);
-
-          applyOutputs(T, H, RN, W, VEC);
-
-          tempHistory[11]  = T;
-          humidHistory[11] = H;
-          rainHistory[11]  = RN;
-          windHistory[11]  = W;
-        }
+  ForecastParser parser(startDate, startTime, hours, out);  // out을 NAN으로 비워 둔다
+  if (!httpGetInto(http, client, url, verbose, parser)) return 0;
+  return parser.finish();
+}
+
+// =============================
+// 시각 t의 정시 관측 (캐시 우선)
+// =============================
+// 지난 정시 관측은 바뀌지 않으므로 캐시에 있으면 요청하지 않는다.
+bool getObservation(HTTPClient& http, WiFiClient& client, int gx, int gy, time_t t,
+                    bool verbose, WeatherObs& obs) {
+  uint32_t baseDate;
+  uint16_t baseTime;
+  hourBaseOf(t, baseDate, baseTime);
+
+  if (obsCacheGet(gx, gy, baseDate, baseTime, obs)) return true;
+  if (!fetchNcst(http, client, gx, gy, baseDate, baseTime, verbose, obs)) return false;
+  obsCachePut(gx, gy, baseDate, baseTime, obs);
+  return true;
+}
+
+// =============================
+// 12시간 데이터 가져오기 (core 0 작업)
+// =============================
+// loop()는 요청만 넣고 바로 돌아가고, HTTP는 fetchTask가 core 0에서 처리한다.
+// 한 시간치가 올 때마다 결과 큐로 보내고, loop()가 pollWeatherResults에서 받아 그래프를 다시 그린다.
+// 히스토리 배열, OLED, LED는 loop()에서만 건드린다.
+static void sendFetchResult(uint32_t id, bool done, bool now, long hour, bool ok, const WeatherObs& obs,
+                            bool forecast = false) {
+  FetchResult r = {};
+  r.forecast = forecast;
+  r.id = id;
+  r.done = done;
+  r.now = now;
+  r.hour = (int32_t)hour;
+  r.ok = ok;
+  r.obs = obs;
+  xQueueSend(fetchResultQueue, &r, portMAX_DELAY);
+}
+
+// 로그에서 읽은 시간을 받은 시간과 같은 길로 loop에 보내고, 그래프 창 안이면 빠진 시간에서 뺀다.
+struct LogLoad {
+  const FetchRequest* req;
+  uint16_t missing;
+};
+
+static void sendLoggedHour(void* ctx, int32_t hour, const PackedObs& s) {
+  LogLoad& load = *(LogLoad*)ctx;
+  FetchResult r = {};
+  r.id = load.req->id;
+  r.now = hour == load.req->nowHour;
+  r.hour = hour;
+  r.ok = true;
+  r.obs = unpackObs(s);
+  r.fromLog = true;
+  xQueueSend(fetchResultQueue, &r, portMAX_DELAY);
+
+  long k = load.req->nowHour - hour;
+  if (k >= 0 && k < GRAPH_HOURS) load.missing &= (uint16_t)~(1u << k);
+}
+
+// 플래시 로그에 있는 시간을 먼저 채우고, 그래도 빠진 시간을 돌려준다. (WiFi 없이도)
+static uint16_t loadHistoryLog(const FetchRequest& req) {
+  LogLoad load = { &req, req.missing };
+  int n = historyLogLoad(req.nx, req.ny, req.nowHour - HISTORY_HOURS + 1, req.nowHour,
+                         sendLoggedHour, &load);
+  if (n > 0) Serial.printf("=== history log: %d h ===\n", n);
+  return load.missing;
+}
+
+static void runHistoryFetch(const FetchRequest& req) {
+  WeatherObs none = {};
+  uint16_t missing = req.loadLog ? loadHistoryLog(req) : req.missing;
+
+  if (WiFi.status() != WL_CONNECTED) {
+    sendFetchResult(req.id, true, false, -1, false, none);
+    return;
+  }
+
+  // 빠진 시간들이 한 연결(한 번의 TLS 핸드셰이크)을 같이 쓴다. http:// 호스트(대체 서버)면 TLS 없이.
+  WiFiClientSecure tls; tls.setInsecure();
+  WiFiClient plain;
+  WiFiClient& client = strncmp(host, "https:", 6) == 0 ? tls : plain;
+  HTTPClient http;
+  http.setReuse(true);
+
+#ifdef HISTORY_FROM_FORECAST
+  WeatherObs fcst[GRAPH_HOURS - 1];  // fcst[i] = now - (GRAPH_HOURS - 1 - i)시간
+  bool fcstTried = false;
+#endif
+
+  // 현재(k = 0)를 먼저, 다음은 오래된 시간부터 (k = now에서 몇 시간 전)
+  for (int n = 0; n < GRAPH_HOURS; n++) {
+    // 새 요청(다른 지역)이 들어왔으면 나머지는 그만 받는다.
+    if (!fetchSchedIsCurrent(req.id)) break;
+
+    int k = n == 0 ? 0 : GRAPH_HOURS - n;
+    if (!(missing & (1u << k))) continue;  // 이미 기록(또는 로그)에 있음
+    time_t t = req.now - k * 3600;
+
+#ifdef HISTORY_FROM_FORECAST
+    // 지난 시간 중 기록에도 캐시에도 없는 시간이 2개 이상이면 단기예보 한 번으로 받아 둔다.
+    // 예보 값은 관측이 아니므로 캐시에 넣지 않고, 예보에 없는 시간만 시간별 실황으로 채운다.
+    if (k > 0 && !fcstTried) {
+      fcstTried = true;
+      int missing = 0;
+      for (int j = 1; j < GRAPH_HOURS; j++) {
+        uint32_t d; uint16_t h; WeatherObs tmp;
+        hourBaseOf(req.now - j * 3600, d, h);
+        if ((missing & (1u << j)) && !obsCacheGet(req.nx, req.ny, d, h, tmp)) missing++;
+      }
+      if (missing < 2 ||
+          fetchVilageFcst(http, client, req.nx, req.ny, req.now - (GRAPH_HOURS - 1) * 3600,
+                          GRAPH_HOURS - 1, false, fcst) == 0) {
+        for (int j = 0; j < GRAPH_HOURS - 1; j++) fcst[j].T1H = fcst[j].REH = NAN;
+      }
+    }
+#endif
+
+    WeatherObs o;
+    bool ok = false;
+    bool fromForecast = false;
+#ifdef HISTORY_FROM_FORECAST
+    if (k > 0) {
+      uint32_t d; uint16_t h;
+      hourBaseOf(t, d, h);
+      const WeatherObs& f = fcst[GRAPH_HOURS - 1 - k];
+      if (!obsCacheGet(req.nx, req.ny, d, h, o) && !isnan(f.T1H) && !isnan(f.REH)) {
+        o = f;
+        ok = true;
+        fromForecast = true;
       }
-      http.end();
     }
+    if (!ok)
+#endif
+    ok = getObservation(http, client, req.nx, req.ny, t, k == 0, o);
+    sendFetchResult(req.id, false, k == 0, req.nowHour - k, ok, o, fromForecast);
   }
 
-  // 2) 나머지 11시간 채우기 (과거 데이터)
-  for (int i = 0; i < 11; i++) {
-    // now(보정된 기준시간)에서 i시간 전
-    time_t t = now - (11 - i) * 3600;
-    struct tm* bt = localtime(&t);
-
-    char baseDate[9];
-    sprintf(baseDate, "%04d%02d%02d",
-            bt->tm_year + 1900,
-            bt->tm_mon + 1,
-            bt->tm_mday);
-
-    char baseTime[5];
-    sprintf(baseTime, "%02d00", bt->tm_hour);
-
-    String url = String(host) +
-      "/api/typ02/openApi/VilageFcstInfoService_2.0/getUltraSrtNcst"
-      "?authKey=" + authKey +
-      "&dataType=JSON"
-      "&numOfRows=60"
-      "&pageNo=1"
-      "&base_date=" + baseDate +
-      "&base_time=" + baseTime +
-      "&nx=" + nx +
-      "&ny=" + ny;
-
-    Serial.print("["); Serial.print(i); Serial.print("] ");
-    // Serial.print(baseDate); Serial.print(" ");
-    // Serial.print(baseTime); Serial.println(" URL:");
-    // Serial.println(url);
-
-    WiFiClientSecure client; client.setInsecure();
-    HTTPClient http;
+  client.stop();
+  obsCacheFlush();
+  sendFetchResult(req.id, true, false, -1, true, none);
+}
 
-    if (http.begin(client, url)) {
-      int code = http.GET();
-      // Serial.print("  HTTP code: ");
-      // Serial.println(code);
-      if (code == 200) {
-        String js = http.getString();
-        float T, H, RN, W, VEC;
-        if (extractWeather(js, T, H, RN, W, VEC)) {
-          tempHistory[i]  = T;
-          humidHistory[i] = H;
-          rainHistory[i]  = RN;
-          windHistory[i]  = W;
-
-          Serial.print("  -> T=");  Serial.print(T);
-          Serial.print("C, H=");     Serial.print(H);
-          Serial.println("%");
-        }
-      }
-      http.end();
+// 관심 지역 격자 c의 빠진 시간을 받는다. 화면 지역 요청이 기다리고 있으면 멈추고 false
+static bool refreshWatchCell(HTTPClient& http, WiFiClient& client, const WatchRequest& w, int c) {
+  for (int k = 0; k < WATCHLIST_HOURS; k++) {
+    if (!(w.missing[c] & (1u << k))) continue;
+    if (uxQueueMessagesWaiting(fetchRequestQueue) > 0) return false;
+
+    FetchResult r = {};
+    r.watch = true;
+    r.nx = w.nx[c];
+    r.ny = w.ny[c];
+    r.hour = w.nowHour - k;
+    r.ok = getObservation(http, client, w.nx[c], w.ny[c], w.now - k * 3600, false, r.obs);
+    if (r.ok) xQueueSend(fetchResultQueue, &r, portMAX_DELAY);
+  }
+  return true;
+}
+
+// 관심 지역 갱신: 모든 격자의 빠진 시간을 한 연결로 받는다.
+// 화면 지역 요청이 들어오면 그만두고, 못 받은 시간은 다음 주기에 다시 빠진 것으로 잡힌다.
+static void runWatchRefresh(const WatchRequest& w) {
+  if (WiFi.status() != WL_CONNECTED) return;
+
+  WiFiClientSecure tls; tls.setInsecure();
+  WiFiClient plain;
+  WiFiClient& client = strncmp(host, "https:", 6) == 0 ? tls : plain;
+  HTTPClient http;
+  http.setReuse(true);
+
+  for (int c = 0; c < w.count; c++) {
+    if (!refreshWatchCell(http, client, w, c)) break;
+  }
+
+  client.stop();
+  obsCacheFlush();
+}
+
+void fetchTask(void*) {
+  FetchRequest req;
+  WatchRequest watch;
+  for (;;) {
+    // 화면 지역 요청이 먼저, 없으면 관심 지역 갱신
+    if (xQueueReceive(fetchRequestQueue, &req, pdMS_TO_TICKS(500)) == pdTRUE) {
+      runHistoryFetch(req);
+    } else if (xQueueReceive(watchRequestQueue, &watch, 0) == pdTRUE) {
+      runWatchRefresh(watch);
     }
-    // API 호출 간격
-    delay(200);
   }
+}
 
-  // 그래프 갱신
-  drawGraph();
+// 관심 지역마다 빠진 시간을 모아서 fetchTask에 넘긴다. (바로 돌아옴)
+void requestWatchRefresh() {
+  if (watchlistCount() == 0) return;
+
+  WatchRequest w = {};
+  w.nowHour = latestObsHour(&w.now);
+
+  for (int i = 0; i < WATCHLIST_SIZE; i++) {
+    const WatchCell& cell = watchlistAt(i);
+    if (cell.nx == 0) continue;
+    uint16_t missing = watchlistMissing(i, w.nowHour);
+    if (missing == 0) continue;
+    w.nx[w.count] = cell.nx;
+    w.ny[w.count] = cell.ny;
+    w.missing[w.count] = missing;
+    w.count++;
+  }
+  if (w.count > 0) xQueueOverwrite(watchRequestQueue, &w);
 }
 
+// 관심 지역 목록과 각 지역의 가장 최근 값
+void printWatchlist() {
+  time_t now;
+  long nowHour = latestObsHour(&now);
 
-// =============================
-// JSON 파싱
-// =============================
-bool extractWeather(const String& json,
-                    float &T1H, float &REH,
-                    float &RN1, float &WSD, float &VEC){
+  Serial.printf("⭐ Watchlist %d/%d\n", watchlistCount(), WATCHLIST_SIZE);
+  for (int i = 0; i < WATCHLIST_SIZE; i++) {
+    const WatchCell& cell = watchlistAt(i);
+    if (cell.nx == 0) continue;
 
-  JsonDocument doc;
-  DeserializationError err = deserializeJson(doc, json);
-  if(err){
-    Serial.print("JSON error: ");
-    Serial.println(err.c_str());
-    return false;
+    String name;
+    if (!findLocationNameByXY(cell.nx, cell.ny, name)) name = "?";
+
+    int have = WATCHLIST_HOURS - __builtin_popcount(watchlistMissing(i, nowHour));
+    Serial.printf("  %3d,%3d %s (%d/%dh)", cell.nx, cell.ny, name.c_str(), have, WATCHLIST_HOURS);
+
+    for (int k = 0; k < WATCHLIST_HOURS; k++) {
+      WeatherObs o;
+      if (watchlistGet(i, nowHour - k, o)) {
+        Serial.printf("  T=%.1fC H=%.0f%% (-%dh)", o.T1H, o.REH, k);
+        break;
+      }
+    }
+    Serial.println();
   }
+}
 
-  JsonArray arr = doc["response"]["body"]["items"]["item"].as<JsonArray>();
-  if(arr.isNull()) return false;
+// 현재 nx, ny의 최근 GRAPH_HOURS시간 중 기록에 없는 시간만 요청한다. (바로 돌아옴)
+// 같은 격자를 받는 중이거나 방금 다 받았으면 스케줄러가 걸러서 새로 받지 않는다.
+void getWeatherHistory12h() {
+  bool shown = nx == fetchedNx && ny == fetchedNy;
+  time_t now;
+  long nowHour = latestObsHour(&now);
+
+  // 다른 격자로 바뀌었으면 이전 지역 기록을 지운다.
+  // 플래시 로그에 있는 시간은 fetchTask가 먼저 읽어서 받은 시간처럼 보내 준다. (loop에서 파일을 읽지 않음)
+  if (!shown) {
+    history.clear();
+    fetchedNx = nx;
+    fetchedNy = ny;
+  }
 
-  T1H=REH=RN1=WSD=VEC=NAN;
+  // 한 시간이 지났으면 그래프 창만 옮긴다. (지난 시간은 기록에 그대로 있음)
+  if (!shown || nowHour != historyNowHour) {
+    historyNowHour = nowHour;
+    drawGraph();
+  }
 
-  for(JsonObject o : arr){
-    const char* cat = o["category"];
-    float v = o["obsrValue"].as<float>();
+  uint16_t missing = (uint16_t)history.missing(nowHour, GRAPH_HOURS);
+  if (missing == 0) {
+    Serial.println("=== 12h history: up to date ===");
+    return;
+  }
 
-    if(strcmp(cat,"T1H")==0) T1H=v;
-    if(strcmp(cat,"REH")==0) REH=v;
-    if(strcmp(cat,"RN1")==0) RN1=v;
-    if(strcmp(cat,"WSD")==0) WSD=v;
-    if(strcmp(cat,"VEC")==0) VEC=v;
+  uint32_t gen;
+  FetchDecision decision = fetchSchedRequest(nx, ny, shown, millis(), &gen);
+  if (decision == FETCH_COALESCED) {
+    Serial.println("=== 12h history: already fetching ===");
+    return;
   }
-  return !isnan(T1H) && !isnan(REH);
+  if (decision == FETCH_RECENT) {
+    Serial.println("=== 12h history: fetched recently ===");
+    return;
+  }
+
+  FetchRequest req = { gen, nx, ny, now, (int32_t)nowHour, missing, !shown };
+  fetchFailed = false;
+
+  Serial.printf("\n=== Fetch 12h history (%d h) ===\n", __builtin_popcount(missing));
+  xQueueOverwrite(fetchRequestQueue, &req);
 }
 
+// fetchTask가 보낸 결과를 기록에 넣고, 바뀐 게 있으면 그래프를 다시 그린다.
+void pollWeatherResults() {
+  FetchResult r;
+  bool changed = false;
+
+  while (xQueueReceive(fetchResultQueue, &r, 0) == pdTRUE) {
+    if (r.watch) {
+      watchlistStore(watchlistFind(r.nx, r.ny), r.hour, r.obs);  // 그 사이 목록에서 빠졌으면 무시됨
+      continue;
+    }
+    if (!fetchSchedIsCurrent(r.id)) continue;  // 이미 다른 요청으로 바뀜
+
+    if (r.done) {
+      Serial.println(r.ok ? "=== 12h history done ===" : "⚠ WiFi not connected");
+      fetchSchedDone(r.id, r.ok && !fetchFailed, millis());
+      historyLogFlush();  // 이번에 받은 시간들을 블록 하나로
+      continue;
+    }
+    long ago = historyNowHour - r.hour;
+    if (!r.ok) {
+      Serial.printf("[-%ldh] fetch failed\n", ago);
+      fetchFailed = true;
+      continue;
+    }
+
+    // 기록에 넣은(줄인) 값으로 출력해서 LED, OLED, 그래프가 같은 값을 쓰게 한다.
+    PackedObs packed = packObs(r.obs);
+    history.put(r.hour, packed);
+    if (!r.fromLog) historyLogStage(fetchedNx, fetchedNy, r.hour, packed, r.forecast);
+    WeatherObs v = unpackObs(packed);
+    changed = true;
+
+    if (r.now) {
+      Serial.print("  Now T=");  Serial.print(v.T1H);
+      Serial.print("C, H=");     Serial.print(v.REH);
+      Serial.print("%, RN=");    Serial.print(v.RN1);
+      Serial.print("mm, W=");    Serial.print(v.WSD);
+      Serial.print("m/s, VEC=");
+      Serial.println(v.VEC);
+
+      applyOutputs(v.T1H, v.REH, v.RN1, v.WSD, v.VEC);
+    } else if (!r.fromLog) {  // 로그에서 읽은 시간은 한 줄 요약만 (loadHistoryLog)
+      Serial.printf("[-%ldh] ", ago);
+      Serial.print("  -> T=");  Serial.print(v.T1H);
+      Serial.print("C, H=");    Serial.print(v.REH);
+      Serial.println("%");
+    }
+  }
+
+  if (changed) drawGraph();
+}
+
+
 // =============================
 // LED + Main OLED
 // =============================
@@ -549,34 +1031,65 @@ void applyOutputs(float T, float H, float RN, float W, float VEC){
 // =============================
 // 그래프 표시
 // =============================
-void drawGraph(){
-  graphDisplay.clearDisplay();
+// 그래프 좌표
+#define GRAPH_TOP 18
+#define GRAPH_BOT 48
+#define GRAPH_LEFT 8
+#define GRAPH_RIGHT 120
+
+static const int graphTickIdx[5] = {0, 3, 6, 9, GRAPH_HOURS - 1};
+
+static int graphX(int i) {
+  return GRAPH_LEFT + (int)round((float)(GRAPH_RIGHT - GRAPH_LEFT) / (GRAPH_HOURS - 1) * i);
+}
+
+// 바뀌지 않는 부분(축 눈금)은 한 번만 그려 두고 매번 복사해서 시작한다.
+static uint8_t graphChrome[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+static bool graphChromeReady = false;
+
+static void beginGraphFrame() {
+  uint8_t* buf = graphDisplay.getBuffer();
+  if (!graphChromeReady) {
+    graphDisplay.clearDisplay();
+    for (int k = 0; k < 5; k++) {
+      graphDisplay.drawFastVLine(graphX(graphTickIdx[k]), GRAPH_BOT + 1, 3, SSD1306_WHITE);
+    }
+    memcpy(graphChrome, buf, sizeof(graphChrome));
+    graphChromeReady = true;
+  }
+  memcpy(buf, graphChrome, sizeof(graphChrome));
+}
+
+// 모드마다 그려 둔 화면. 값이 바뀔 때(drawGraph) 네 장을 다 그리고,
+// 모드 전환(showGraph)은 복사 한 번과 바뀐 부분 전송만 한다.
+static uint8_t graphFrames[4][SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+
+// mode의 그래프를 graphDisplay 버퍼에 그린다. (전송은 안 함)
+static void renderGraph(int mode, const float src[]){
   graphDisplay.setTextSize(1);
   graphDisplay.setTextColor(SSD1306_WHITE);
 
-  float* src;
   const char* title;
-
-  switch(graphMode){
-    case 0: src=tempHistory;  title="Temp (C)";       break;
-    case 1: src=humidHistory; title="Humid (%)";      break;
-    case 2: src=rainHistory;  title="Rain (mm,log)";  break;
-    default: src=windHistory; title="Wind (m/s)";     break;
+  switch(mode){
+    case 0: title="Temp (C)";       break;
+    case 1: title="Humid (%)";      break;
+    case 2: title="Rain (mm,log)";  break;
+    default: title="Wind (m/s)";    break;
   }
 
   // 유효 확인
   bool ok=false;
-  for(int i=0;i<12;i++){ if(!isnan(src[i])){ ok=true; break; } }
+  for(int i=0;i<GRAPH_HOURS;i++){ if(!isnan(src[i])){ ok=true; break; } }
   if(!ok){
+    graphDisplay.clearDisplay();
     graphDisplay.setCursor(0,20);
     graphDisplay.print("No data");
-    graphDisplay.display();
     return;
   }
 
   // 원래 값 min/max
   float minO=9999,maxO=-9999;
-  for(int i=0;i<12;i++){
+  for(int i=0;i<GRAPH_HOURS;i++){
     if(!isnan(src[i])){
       if(src[i] < minO) minO = src[i];
       if(src[i] > maxO) maxO = src[i];
@@ -585,17 +1098,17 @@ void drawGraph(){
   if(minO==maxO) maxO=minO+1;
 
   // y축용 맵값 (rain은 log scale)
-  float ymap[12];
-  for(int i=0;i<12;i++){
+  float ymap[GRAPH_HOURS];
+  for(int i=0;i<GRAPH_HOURS;i++){
     if(isnan(src[i])){ ymap[i]=NAN; continue; }
-    if(graphMode==2)
+    if(mode==2)
       ymap[i]=log10f(1+max(0.0f,src[i]));
     else
       ymap[i]=src[i];
   }
 
   float minV=9999,maxV=-9999;
-  for(int i=0;i<12;i++){
+  for(int i=0;i<GRAPH_HOURS;i++){
     if(!isnan(ymap[i])){
       if(ymap[i] < minV) minV = ymap[i];
       if(ymap[i] > maxV) maxV = ymap[i];
@@ -603,6 +1116,9 @@ void drawGraph(){
   }
   if(minV==maxV) maxV=minV+1;
 
+  // 축 눈금이 그려진 화면에서 시작
+  beginGraphFrame();
+
   // 제목 + min/max
   graphDisplay.setCursor(0,0);
   graphDisplay.print(title);
@@ -610,19 +1126,14 @@ void drawGraph(){
   graphDisplay.setCursor(0,10);
   graphDisplay.printf("min %.1f max %.1f",minO,maxO);
 
-  // 그래프 좌표
-  int gTop=18, gBot=48;
-  int gHeight = gBot - gTop;
-  int gLeft=8, gRight=120;
-  float stepX=(float)(gRight-gLeft)/11.0f;
-
+  int gHeight = GRAPH_BOT - GRAPH_TOP;
   int lastX=-1,lastY=-1;
 
-  for(int i=0;i<12;i++){
+  for(int i=0;i<GRAPH_HOURS;i++){
     if(isnan(ymap[i])) continue;
 
-    int x = gLeft + round(stepX*i);
-    int y = gBot - round((ymap[i]-minV)*gHeight/(maxV-minV));
+    int x = graphX(i);
+    int y = GRAPH_BOT - round((ymap[i]-minV)*gHeight/(maxV-minV));
 
     // 점
     graphDisplay.fillRect(x-1,y-1,3,3,SSD1306_WHITE);
@@ -634,34 +1145,54 @@ void drawGraph(){
     lastX=x; lastY=y;
   }
 
-  // 시간 축 (실제 시각 표시)
-  struct tm ti;
-  getLocalTime(&ti);
-  int nowH=ti.tm_hour;
-
-  int idxs[5]={0,3,6,9,11};
+  // 시간 축 (기록의 시각 표시, kmaHourIndex는 한국 시각 기준이라 % 24가 그 시)
+  int nowH = (int)(historyNowHour % 24);
 
   for(int k=0;k<5;k++){
-    int idx = idxs[k];
-    int hour = (nowH - (11 - idx) + 24) % 24;
-
-    int x = gLeft + round(stepX*idx);
+    int idx = graphTickIdx[k];
+    int hour = (nowH - (GRAPH_HOURS - 1 - idx) + 24) % 24;
 
-    // 축 눈금
-    graphDisplay.drawFastVLine(x,gBot+1,3,SSD1306_WHITE);
+    int x = graphX(idx);
 
     char buf[4];
     sprintf(buf,"%02d",hour);
 
     int labelX = x-6;
     if(labelX < 0) labelX = 0;
-    int labelY = gBot+4;   // y=52 근처
+    int labelY = GRAPH_BOT+4;   // y=52 근처
 
     graphDisplay.setCursor(labelX,labelY);
     graphDisplay.print(buf);
   }
+}
+
+// 기록이 바뀌었을 때: 네 모드 화면을 다시 그려 두고 지금 모드를 보여 준다.
+void drawGraph(){
+  // 최근 GRAPH_HOURS시간 창을 오래된 시간부터, 모드별로 한 번에 (없는 시간은 NAN)
+  float src[4][GRAPH_HOURS];
+  history.window(historyNowHour, GRAPH_HOURS, [&src](int i, const PackedObs* p) {
+    if (p == nullptr) {
+      for (int m = 0; m < 4; m++) src[m][i] = NAN;
+      return;
+    }
+    WeatherObs o = unpackObs(*p);
+    src[0][i] = o.T1H;
+    src[1][i] = o.REH;
+    src[2][i] = o.RN1;
+    src[3][i] = o.WSD;
+  });
+
+  for (int m = 0; m < 4; m++) {
+    renderGraph(m, src[m]);
+    memcpy(graphFrames[m], graphDisplay.getBuffer(), sizeof(graphFrames[m]));
+  }
+  showGraph();
+}
 
-  graphDisplay.display();
+// 그려 둔 지금 모드 화면을 버퍼에 넣고 바뀐 페이지/열만 I2C로
+void showGraph(){
+  memcpy(graphDisplay.getBuffer(), graphFrames[graphMode], sizeof(graphFrames[graphMode]));
+  graphDisplay.displayChanged();
 }
 
 // =======================================================
@@ -688,10 +1219,13 @@ GridPoint getLocation() {
         // 1. 위경도를 기상청 격자(X, Y)로 변환
         point = changeToXY(lat, lon);
         
-        // 2. location.h에서 최적 지역(동 이름) 검색 (New Algorithm)
-        const char* regionName = findNearestRegion(point.x, point.y, lat, lon);
+        // 2. location.h에서 가까운 지역(동 이름) 검색 - 첫 번째가 현재 지역, 나머지는 주변 후보
+        RegionMatch nearby[3];
+        int nearbyCount = findNearestRegions(lat, lon, 3, nearby);
+        char regionName[LOCATION_NAME_BUF];
         
-        if (regionName != NULL) {
+        if (nearbyCount > 0) {
+            getLocationName(nearby[0].row, regionName, sizeof(regionName));
             currentLocationName = String(regionName);
         } else {
             currentLocationName = "Unknown Loc";
@@ -706,6 +1240,10 @@ GridPoint getLocation() {
         Serial.print(" Grid X    : "); Serial.println(point.x);
         Serial.print(" Grid Y    : "); Serial.println(point.y);
         Serial.print(" Location  : "); Serial.println(currentLocationName);
+        for (int i = 1; i < nearbyCount; i++) {
+            getLocationName(nearby[i].row, regionName, sizeof(regionName));
+            Serial.printf(" Nearby    : %s (%.1f km)\n", regionName, nearby[i].distanceKm);
+        }
         Serial.println("=====================================");
         
       } else {
@@ -722,112 +1260,3 @@ GridPoint getLocation() {
   }
   return point;
 }
-
-// 위도, 경도를 입력받아 격자 X, Y를 반환하는 함수
-GridPoint changeToXY(double lat, double lon) {
-    GridPoint point;
-    
-    double re = RE / GRID;
-    double slat1 = SLAT1 * DEGRAD;
-    double slat2 = SLAT2 * DEGRAD;
-    double olon = OLON * DEGRAD;
-    double olat = OLAT * DEGRAD;
-
-    double sn = tan(M_PI * 0.25 + slat2 * 0.5) / tan(M_PI * 0.25 + slat1 * 0.5);
-    sn = log(cos(slat1) / cos(slat2)) / log(sn);
-    
-    double sf = tan(M_PI * 0.25 + slat1 * 0.5);
-    sf = pow(sf, sn) * cos(slat1) / sn;
-    
-    double ro = tan(M_PI * 0.25 + olat * 0.5);
-    ro = re * sf / pow(ro, sn);
-
-    double ra = tan(M_PI * 0.25 + lat * DEGRAD * 0.5);
-    ra = re * sf / pow(ra, sn);
-    
-    double theta = lon * DEGRAD - olon;
-    if (theta > M_PI) theta -= 2.0 * M_PI;
-    if (theta < -M_PI) theta += 2.0 * M_PI;
-    theta *= sn;
-
-    point.x = (int)floor(ra * sin(theta) + XO + 0.5);
-    point.y = (int)floor(ro - ra * cos(theta) + YO + 0.5);
-
-    return point;
-}
-
-// =======================================================
-// [수정됨] 이름으로 좌표 찾기 (locationNameList 사용)
-// =======================================================
-bool findXYByLocation(const char* inputName, int* outX, int* outY) {
-  LocationName loc; 
-
-  for (int i = 0; i < locationCount; i++) {
-    // [FIX] locationName -> locationNameList (새로운 헤더 파일 변수명)
-    memcpy_P(&loc, &locationNameList[i], sizeof(LocationName));
-
-    char nameBuffer[64];
-    strcpy(nameBuffer, loc.name);
-
-    if (strcmp(nameBuffer, inputName) == 0) {
-      *outX = loc.gridX;
-      *outY = loc.gridY;
-      return true;
-    }
-  }
-  return false; 
-}
-
-// =======================================================
-// [수정됨] 좌표로 이름 찾기 (locationNameList 사용)
-// =======================================================
-bool findLocationNameByXY(int gx, int gy, String &outName) {
-  LocationName loc;
-  for (int i = 0; i < locationCount; i++) {
-    // [FIX] locationName -> locationNameList (새로운 헤더 파일 변수명)
-    memcpy_P(&loc, &locationNameList[i], sizeof(LocationName));
-    
-    if (loc.gridX == gx && loc.gridY == gy) {
-      outName = String(loc.name);
-      return true;
-    }
-  }
-  return false;
-}
-
-// =======================================================
-// [최적 지역 찾기] ESP32 전용 수정 (직접 접근 방식)
-// =======================================================
-double getDistanceSquared(double lat1, double lon1, double lat2, double lon2) {
-    double dLat = lat1 - lat2;
-    double dLon = lon1 - lon2;
-    return (dLat * dLat) + (dLon * dLon);
-}
-
-const char* findNearestRegion(int inputX, int inputY, double currentLat, double currentLon) {
-    const char* bestMatchName = NULL;
-    double minDistanceSq = DBL_MAX;
-    
-    for (int i = 0; i < locationCount; i++) {
-        // [수정] ESP32는 pgm_read_word 등을 쓰지 않고 배열처럼 직접 읽습니다.
-        // 이렇게 해야 double(8바이트) 값을 정확하게 가져올 수 있습니다.
-        int16_t dataX = locationList[i].gridX;
-        int16_t dataY = locationList[i].gridY;
-
-        // 1. 내 위치 기준 앞뒤 1칸(3x3 영역)에 있는 모든 데이터를 후보로 둡니다.
-        if (abs(dataX - inputX) <= 1 && abs(dataY - inputY) <= 1) {
-            
-            // [수정] 구조체 멤버에 직접 접근
-            double centerLat = locationList[i].lat; 
-            double centerLon = locationList[i].lon;
-
-            double distSq = getDistanceSquared(centerLat, centerLon, currentLat, currentLon);
-
-            if (distSq < minDistanceSq) {
-                minDistanceSq = distSq;
-                bestMatchName = locationList[i].name;
-            }
-        }
-    }
-    return bestMatchName;
-}
\ No newline at end of file
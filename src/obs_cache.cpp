@@ -0,0 +1,113 @@
+#include <Arduino.h>
+#include <string.h>
+#ifdef OBS_CACHE_LITTLEFS
+#include <LittleFS.h>
+#endif
+
+#include "obs_cache.h"
+
+// =============================
+// 캐시 항목
+// =============================
+struct ObsEntry {
+  uint32_t baseDate;  // 0이면 빈 칸
+  uint16_t baseTime;
+  uint8_t nx;
+  uint8_t ny;
+  uint32_t lastUse;   // LRU용 사용 순번
+  WeatherObs obs;
+};
+
+static ObsEntry entries[OBS_CACHE_SIZE];
+static uint32_t useClock = 0;
+static bool dirty = false;
+
+static ObsEntry* findEntry(int nx, int ny, uint32_t baseDate, uint16_t baseTime) {
+  for (int i = 0; i < OBS_CACHE_SIZE; i++) {
+    ObsEntry& e = entries[i];
+    if (e.baseDate == baseDate && e.baseTime == baseTime && e.nx == nx && e.ny == ny) return &e;
+  }
+  return nullptr;
+}
+
+bool obsCacheGet(int nx, int ny, uint32_t baseDate, uint16_t baseTime, WeatherObs& out) {
+  ObsEntry* e = findEntry(nx, ny, baseDate, baseTime);
+  if (e == nullptr) return false;
+  e->lastUse = ++useClock;
+  out = e->obs;
+  return true;
+}
+
+void obsCachePut(int nx, int ny, uint32_t baseDate, uint16_t baseTime, const WeatherObs& obs) {
+  if (baseDate == 0) return;
+
+  ObsEntry* e = findEntry(nx, ny, baseDate, baseTime);
+  if (e == nullptr) {
+    // 빈 칸, 없으면 가장 오래 안 쓴 칸
+    e = &entries[0];
+    for (int i = 1; i < OBS_CACHE_SIZE && e->baseDate != 0; i++) {
+      if (entries[i].baseDate == 0 || entries[i].lastUse < e->lastUse) e = &entries[i];
+    }
+    e->baseDate = baseDate;
+    e->baseTime = baseTime;
+    e->nx = (uint8_t)nx;
+    e->ny = (uint8_t)ny;
+  }
+  e->lastUse = ++useClock;
+  e->obs = obs;
+  dirty = true;
+}
+
+void obsCacheClear() {
+  memset(entries, 0, sizeof(entries));
+  useClock = 0;
+  dirty = true;
+}
+
+// =============================
+// LittleFS 저장 (선택)
+// =============================
+#ifdef OBS_CACHE_LITTLEFS
+#define OBS_CACHE_PATH "/obs_cache.bin"
+#define OBS_CACHE_MAGIC 0x4F425331u  // "OBS1", 항목 구조가 바뀌면 올릴 것
+
+bool obsCacheBegin() {
+  if (!LittleFS.begin(true)) return false;
+
+  File f = LittleFS.open(OBS_CACHE_PATH, "r");
+  if (!f) return false;
+
+  uint32_t magic = 0;
+  bool ok = f.read((uint8_t*)&magic, sizeof(magic)) == sizeof(magic) && magic == OBS_CACHE_MAGIC &&
+            f.read((uint8_t*)entries, sizeof(entries)) == sizeof(entries);
+  f.close();
+  if (!ok) {
+    memset(entries, 0, sizeof(entries));
+    return false;
+  }
+
+  useClock = 0;
+  for (int i = 0; i < OBS_CACHE_SIZE; i++) {
+    if (entries[i].lastUse > useClock) useClock = entries[i].lastUse;
+  }
+  dirty = false;
+  return true;
+}
+
+bool obsCacheFlush() {
+  if (!dirty) return true;
+
+  File f = LittleFS.open(OBS_CACHE_PATH, "w");
+  if (!f) return false;
+
+  uint32_t magic = OBS_CACHE_MAGIC;
+  bool ok = f.write((const uint8_t*)&magic, sizeof(magic)) == sizeof(magic) &&
+            f.write((const uint8_t*)entries, sizeof(entries)) == sizeof(entries);
+  f.close();
+  if (ok) dirty = false;
+  return ok;
+}
+#else
+bool obsCacheBegin() { return true; }
+bool obsCacheFlush() { dirty = false; return true; }
+#endif // OBS_CACHE_LITTLEFS
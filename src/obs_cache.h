@@ -0,0 +1,29 @@
+#ifndef OBS_CACHE_H
+#define OBS_CACHE_H
+
+#include <stdint.h>
+
+#include "weather.h"
+
+// =============================
+// 초단기실황 관측값 캐시
+// =============================
+// 지난 정시 관측값은 바뀌지 않으므로 (nx, ny, base_date, base_time)으로 한 번 받은 값은
+// 다시 요청하지 않는다. 12시간 갱신은 새로 생긴 한 시간만, 최근에 본 지역으로 돌아가면
+// 요청 없이 채워진다.
+// OBS_CACHE_LITTLEFS 빌드에서는 LittleFS(/obs_cache.bin)에 저장해서 재부팅 뒤에도 쓴다.
+
+#define OBS_CACHE_SIZE 64  // 항목 수 (12시간 x 약 5개 지역), 가득 차면 가장 오래 안 쓴 것부터 버림
+
+// baseDate: YYYYMMDD, baseTime: HHMM (요청 URL의 base_date, base_time과 같은 값)
+bool obsCacheGet(int nx, int ny, uint32_t baseDate, uint16_t baseTime, WeatherObs& out);
+void obsCachePut(int nx, int ny, uint32_t baseDate, uint16_t baseTime, const WeatherObs& obs);
+
+// 캐시 비우기
+void obsCacheClear();
+
+// LittleFS에서 읽기 / 바뀐 내용이 있으면 쓰기 (OBS_CACHE_LITTLEFS가 아니면 아무것도 안 함)
+bool obsCacheBegin();
+bool obsCacheFlush();
+
+#endif // OBS_CACHE_H
@@ -0,0 +1,596 @@
+#include <Arduino.h>
+#include <pgmspace.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "grid.h"
+#include "location.h"
+#include "location_index.h"
+#include "location_check.h"
+#include "region.h"
+#ifdef LOCATION_RASTER
+#include "location_raster.h"
+#endif
+
+static_assert(LOCATION_NAME_MAX < LOCATION_NAME_BUF, "LOCATION_NAME_BUF too small for location.h");
+
+// =======================================================
+// 이름 조립 (locationNameList + locationNamePool)
+// =======================================================
+// 행의 이름 조각을 아래 단계부터 parts에 모으고 단계 수를 돌려준다.
+// (parts[depth - 1]이 최상위 지역)
+static int collectNameParts(int row, LocationName parts[LOCATION_NAME_DEPTH]) {
+  int depth = 0;
+  while (row >= 0 && depth < LOCATION_NAME_DEPTH) {
+    memcpy_P(&parts[depth], &locationNameList[row], sizeof(LocationName));
+    row = (int)parts[depth].parent - 1;
+    depth++;
+  }
+  return depth;
+}
+
+// piece를 s 앞부분과 비교하고 맞춘 만큼 s를 옮긴다. (strcmp와 같은 부호)
+static int comparePiece(const char* piece, const char*& s) {
+  for (; *piece; piece++, s++) {
+    if (*piece != *s) return (unsigned char)*piece < (unsigned char)*s ? -1 : 1;
+  }
+  return 0;
+}
+
+// strcmp(행의 전체 이름, s)와 같은 결과를 이름을 만들지 않고 구한다.
+static int compareLocationName(int row, const char* s) {
+  LocationName parts[LOCATION_NAME_DEPTH];
+  int depth = collectNameParts(row, parts);
+
+  for (int d = depth - 1; d >= 0; d--) {
+    int c;
+    if (d != depth - 1 && (c = comparePiece(" ", s)) != 0) return c;
+    if ((c = comparePiece(&locationNamePool[parts[d].stem], s)) != 0) return c;
+    if ((c = comparePiece(locationNameSuffix[parts[d].suffix], s)) != 0) return c;
+  }
+  return *s ? -1 : 0;
+}
+
+size_t getLocationName(int row, char* buf, size_t size) {
+  LocationName parts[LOCATION_NAME_DEPTH];
+  int depth = collectNameParts(row, parts);
+
+  size_t len = 0;
+  for (int d = depth - 1; d >= 0; d--) {
+    const char* pieces[3] = {
+      d != depth - 1 ? " " : "",
+      &locationNamePool[parts[d].stem],
+      locationNameSuffix[parts[d].suffix],
+    };
+    for (const char* p : pieces) {
+      for (; *p; p++, len++) {
+        if (len + 1 < size) buf[len] = *p;
+      }
+    }
+  }
+  if (size > 0) buf[len < size ? len : size - 1] = '\0';
+  return len;
+}
+
+// =======================================================
+// 이름으로 좌표 찾기 (locationNameOrder 이진 탐색)
+// =======================================================
+// 정렬 인덱스에서 이름을 조각 단위로 바로 비교하므로 중간 복사가 없고,
+// 같은 이름이 여러 개면 표에서 앞선 행을 돌려준다.
+bool findXYByLocation(const char* inputName, int* outX, int* outY) {
+  int lo = 0;
+  int hi = locationCount;
+
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (compareLocationName(pgm_read_word(&locationNameOrder[mid]), inputName) < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo == locationCount) return false;
+
+  int row = pgm_read_word(&locationNameOrder[lo]);
+  if (compareLocationName(row, inputName) != 0) return false;
+
+  *outX = locationList[row].gridX;
+  *outY = locationList[row].gridY;
+  return true;
+}
+
+// =======================================================
+// 이름 검색 (자동완성: 단어 앞부분 / 한 글자 오타)
+// =======================================================
+#define SUGGEST_WORD_MAX 4   // 검색어 단어 수
+#define SUGGEST_WORD_LEN 32  // 단어 하나의 최대 길이
+
+// 검색용 정규화: ASCII 소문자, '-'는 무시(0) (gen_location.py fold_token과 같은 규칙)
+static char foldChar(char c) {
+  if (c == '-') return 0;
+  return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+// 이름 단계 하나(조각 + 접미사)를 정규화해서 buf에 쓰고 길이를 돌려준다.
+static int foldPart(const LocationName& part, char* buf, int size) {
+  int len = 0;
+  const char* pieces[2] = { &locationNamePool[part.stem], locationNameSuffix[part.suffix] };
+  for (const char* p : pieces) {
+    for (; *p && len < size - 1; p++) {
+      char c = foldChar(*p);
+      if (c) buf[len++] = c;
+    }
+  }
+  buf[len] = '\0';
+  return len;
+}
+
+// 정규화된 단어 word가 정규화된 이름 단계 part의 앞부분인지. (strcmp처럼 부호, 0이면 앞부분)
+static int comparePrefix(const char* part, const char* word) {
+  for (; *word; part++, word++) {
+    if (*part != *word) return (unsigned char)*part < (unsigned char)*word ? -1 : 1;
+  }
+  return 0;
+}
+
+// word가 part의 어떤 앞부분과 한 글자 이내(바꿈/빠짐/더함/이웃 두 글자 뒤바뀜)로 같은지
+static bool prefixWithinOneEdit(const char* part, int partLen, const char* word, int wordLen) {
+  // 같은 길이: 한 글자 바꿈 또는 이웃 두 글자 뒤바뀜
+  if (partLen >= wordLen) {
+    int diff = 0;
+    for (int i = 0; i < wordLen && diff <= 2; i++) {
+      if (part[i] != word[i]) diff++;
+    }
+    if (diff <= 1) return true;
+    for (int i = 0; i + 1 < wordLen; i++) {
+      if (part[i] != word[i]) {
+        if (part[i] == word[i + 1] && part[i + 1] == word[i] &&
+            strncmp(part + i + 2, word + i + 2, wordLen - i - 2) == 0) return true;
+        break;
+      }
+    }
+  }
+  // 한 글자 빠뜨림: part 앞 (wordLen + 1)글자에서 하나를 지우면 word
+  if (partLen >= wordLen + 1) {
+    int i = 0;
+    while (i < wordLen && part[i] == word[i]) i++;
+    if (strncmp(part + i + 1, word + i, wordLen - i) == 0) return true;
+  }
+  // 한 글자 더 침: word에서 하나를 지우면 part 앞 (wordLen - 1)글자
+  if (wordLen >= 2 && partLen >= wordLen - 1) {
+    int i = 0;
+    while (i < wordLen - 1 && part[i] == word[i]) i++;
+    if (strncmp(part + i, word + i + 1, wordLen - 1 - i) == 0) return true;
+  }
+  return false;
+}
+
+struct SuggestQuery {
+  int count;
+  char word[SUGGEST_WORD_MAX][SUGGEST_WORD_LEN];
+  int len[SUGGEST_WORD_MAX];
+};
+
+// 점수가 낮은 순서로 최대 n개 (같으면 앞 행 먼저, 같은 행은 한 번만)
+struct SuggestSet {
+  int n;
+  int count;
+  int* rows;
+  int score[REGION_SUGGEST_MAX];
+
+  void offer(int s, int r) {
+    for (int j = 0; j < count; j++) {
+      if (rows[j] != r) continue;
+      if (s >= score[j]) return;
+      for (; j + 1 < count; j++) { rows[j] = rows[j + 1]; score[j] = score[j + 1]; }
+      count--;
+      break;
+    }
+    if (count == n && (s > score[count - 1] || (s == score[count - 1] && r > rows[count - 1]))) return;
+
+    int j = count < n ? count++ : count - 1;
+    while (j > 0 && (s < score[j - 1] || (s == score[j - 1] && r < rows[j - 1]))) {
+      score[j] = score[j - 1];
+      rows[j] = rows[j - 1];
+      j--;
+    }
+    score[j] = s;
+    rows[j] = r;
+  }
+};
+
+// 행의 이름 단계들이 검색어에 맞으면 점수(낮을수록 좋음), 아니면 -1.
+// leafWord 번째 단어는 마지막 단계에, 나머지 단어는 상위 단계 중 하나에 맞아야 한다.
+static int scoreCandidate(int row, const SuggestQuery& q, int leafWord, bool fuzzy) {
+  LocationName parts[LOCATION_NAME_DEPTH];
+  int depth = collectNameParts(row, parts);
+  if (q.count > depth) return -1;
+
+  // 마지막 단계부터 확인하고, 맞을 때만 상위 단계를 정규화한다.
+  char folded[LOCATION_NAME_DEPTH][LOCATION_NAME_BUF];
+  int foldedLen[LOCATION_NAME_DEPTH];
+  foldedLen[0] = foldPart(parts[0], folded[0], LOCATION_NAME_BUF);
+
+  bool leafFuzzy = comparePrefix(folded[0], q.word[leafWord]) != 0;
+  if (leafFuzzy && !(fuzzy && prefixWithinOneEdit(folded[0], foldedLen[0], q.word[leafWord], q.len[leafWord])))
+    return -1;
+  for (int d = 1; d < depth; d++) foldedLen[d] = foldPart(parts[d], folded[d], LOCATION_NAME_BUF);
+
+  int fuzzyWords = leafFuzzy ? 1 : 0;
+  for (int w = 0; w < q.count; w++) {
+    if (w == leafWord) continue;
+    bool matched = false;
+    for (int d = 1; d < depth && !matched; d++) {
+      if (comparePrefix(folded[d], q.word[w]) == 0) matched = true;
+    }
+    for (int d = 1; d < depth && !matched && fuzzy; d++) {
+      if (prefixWithinOneEdit(folded[d], foldedLen[d], q.word[w], q.len[w])) {
+        matched = true;
+        fuzzyWords++;
+      }
+    }
+    if (!matched) return -1;
+  }
+
+  // 오타 없는 것 > 마지막 단계가 단어와 딱 맞는 것 > 상위 행정구역 > 짧은 이름
+  int suffixLen = 0;
+  for (const char* p = locationNameSuffix[parts[0].suffix]; *p; p++) {
+    if (foldChar(*p)) suffixLen++;
+  }
+  int stemLen = foldedLen[0] - suffixLen;
+  bool exact = q.len[leafWord] == foldedLen[0] ||
+               (q.len[leafWord] == stemLen && strncmp(folded[0], q.word[leafWord], stemLen) == 0);
+
+  int leafLen = foldedLen[0] < 99 ? foldedLen[0] : 99;
+  return fuzzyWords * 1000 + (exact ? 0 : 500) + depth * 100 + leafLen;
+}
+
+// 정규화된 단어가 마지막 단계의 앞부분인 행들의 locationTokenOrder 구간 [first, last)
+static void findTokenRange(const char* word, int* first, int* last) {
+  char folded[LOCATION_NAME_BUF];
+  LocationName part;
+
+  int lo = 0, hi = locationCount;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    memcpy_P(&part, &locationNameList[pgm_read_word(&locationTokenOrder[mid])], sizeof(LocationName));
+    foldPart(part, folded, sizeof(folded));
+    if (comparePrefix(folded, word) < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  *first = lo;
+
+  hi = locationCount;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    memcpy_P(&part, &locationNameList[pgm_read_word(&locationTokenOrder[mid])], sizeof(LocationName));
+    foldPart(part, folded, sizeof(folded));
+    if (comparePrefix(folded, word) <= 0) lo = mid + 1;
+    else hi = mid;
+  }
+  *last = lo;
+}
+
+int suggestLocations(const char* query, int rows[], int n) {
+  if (n <= 0) return 0;
+  if (n > REGION_SUGGEST_MAX) n = REGION_SUGGEST_MAX;
+
+  // 검색어를 공백으로 나눠 정규화
+  SuggestQuery q = {};
+  for (const char* p = query; *p && q.count < SUGGEST_WORD_MAX; ) {
+    while (*p == ' ' || *p == ',') p++;
+    int len = 0;
+    for (; *p && *p != ' ' && *p != ','; p++) {
+      char c = foldChar(*p);
+      if (c && len < SUGGEST_WORD_LEN - 1) q.word[q.count][len++] = c;
+    }
+    if (len > 0) {
+      q.word[q.count][len] = '\0';
+      q.len[q.count++] = len;
+    }
+  }
+  if (q.count == 0) return 0;
+
+  SuggestSet best = { n, 0, rows, {} };
+
+  // 1) 단어 앞부분: 각 단어를 마지막 단계로 보고 단어 인덱스 구간만 확인
+  for (int w = 0; w < q.count; w++) {
+    int first, last;
+    findTokenRange(q.word[w], &first, &last);
+    for (int k = first; k < last; k++) {
+      int row = pgm_read_word(&locationTokenOrder[k]);
+      int s = scoreCandidate(row, q, w, false);
+      if (s >= 0) best.offer(s, row);
+    }
+  }
+
+  // 2) 하나도 없으면 한 글자 오타까지 허용해서 전체 확인
+  if (best.count == 0) {
+    for (int row = 0; row < locationCount; row++) {
+      for (int w = 0; w < q.count; w++) {
+        int s = scoreCandidate(row, q, w, true);
+        if (s >= 0) best.offer(s, row);
+      }
+    }
+  }
+  return best.count;
+}
+
+// =======================================================
+// 좌표로 이름 찾기 (격자 버킷 인덱스 사용)
+// =======================================================
+// 격자 버킷 인덱스에서 (gx, gy) 셀 번호를 찾는다. 없으면 -1.
+static int findGridCell(int gx, int gy) {
+  if (gx < GRID_INDEX_X_MIN || gx > GRID_INDEX_X_MAX) return -1;
+
+  int lo = pgm_read_word(&gridColumnStart[gx - GRID_INDEX_X_MIN]);
+  int hi = pgm_read_word(&gridColumnStart[gx - GRID_INDEX_X_MIN + 1]);
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if ((int)pgm_read_byte(&gridCellY[mid]) < gy) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo == pgm_read_word(&gridColumnStart[gx - GRID_INDEX_X_MIN + 1])) return -1;
+  if ((int)pgm_read_byte(&gridCellY[lo]) != gy) return -1;
+  return lo;
+}
+
+int findLocationRowsByXY(int gx, int gy, const uint16_t** rows) {
+  int c = findGridCell(gx, gy);
+  if (c < 0) return 0;
+
+  uint16_t first = pgm_read_word(&gridCellStart[c]);
+  uint16_t last = pgm_read_word(&gridCellStart[c + 1]);
+  *rows = &gridCellRows[first];
+  return last - first;
+}
+
+bool findLocationNameByXY(int gx, int gy, String &outName) {
+  const uint16_t* rows;
+  if (findLocationRowsByXY(gx, gy, &rows) == 0) return false;
+
+  // 셀의 첫 행이 대표 지역
+  char name[LOCATION_NAME_BUF];
+  getLocationName(pgm_read_word(&rows[0]), name, sizeof(name));
+  outName = String(name);
+  return true;
+}
+
+// =======================================================
+// [최적 지역 찾기] 거리 계산
+// =======================================================
+// 경도 1도의 길이는 위도 1도의 cos(lat)배라서, 경도 차이에 그 비율을 곱해서 비교한다.
+// (한국 위도에서 경도를 위도와 같게 보면 동서 방향 거리가 25% 가량 부풀려진다)
+double lonScaleAt(double lat) {
+    return cos(lat * DEGRAD);
+}
+
+double getDistanceSquared(double lat1, double lon1, double lat2, double lon2, double lonScale) {
+    double dLat = lat1 - lat2;
+    double dLon = (lon1 - lon2) * lonScale;
+    return (dLat * dLat) + (dLon * dLon);
+}
+
+// getDistanceSquared 값(도²)을 km로 바꾼다.
+static float distanceKm(double distSq) {
+    return (float)(sqrt(distSq) * DEGRAD * RE);
+}
+
+// 가까운 순서로 최대 k개를 모은다. 거리가 같으면 표에서 앞선 행이 먼저.
+struct NearestSet {
+    int k;
+    int count;
+    double dist[REGION_MATCH_MAX];
+    int row[REGION_MATCH_MAX];
+
+    // 지금 가진 것 중 가장 먼 거리 (아직 k개가 안 되면 무한대)
+    double worst() const { return count < k ? DBL_MAX : dist[count - 1]; }
+
+    void offer(double d, int r) {
+        if (count == k && (d > dist[count - 1] || (d == dist[count - 1] && r > row[count - 1]))) return;
+
+        int j = count < k ? count++ : count - 1;
+        while (j > 0 && (d < dist[j - 1] || (d == dist[j - 1] && r < row[j - 1]))) {
+            dist[j] = dist[j - 1];
+            row[j] = row[j - 1];
+            j--;
+        }
+        dist[j] = d;
+        row[j] = r;
+    }
+};
+
+// 격자 버킷 인덱스에서 (gx, y0) ~ (gx, y1) 셀들의 행 범위를 찾는다.
+// 한 열 안의 셀은 gridY 순으로 이어져 있으므로 결과는 gridCellRows의 연속 구간이다.
+static bool findGridColumnRange(int gx, int y0, int y1, uint16_t* first, uint16_t* last) {
+    if (gx < GRID_INDEX_X_MIN || gx > GRID_INDEX_X_MAX) return false;
+
+    uint16_t c = pgm_read_word(&gridColumnStart[gx - GRID_INDEX_X_MIN]);
+    uint16_t cEnd = pgm_read_word(&gridColumnStart[gx - GRID_INDEX_X_MIN + 1]);
+
+    while (c < cEnd && (int)pgm_read_byte(&gridCellY[c]) < y0) c++;
+    uint16_t c0 = c;
+    while (c < cEnd && (int)pgm_read_byte(&gridCellY[c]) <= y1) c++;
+    if (c == c0) return false;
+
+    *first = pgm_read_word(&gridCellStart[c0]);
+    *last = pgm_read_word(&gridCellStart[c]);
+    return true;
+}
+
+#ifdef LOCATION_SOA
+// =======================================================
+// 배치 거리 커널 (struct-of-arrays 좌표 열, 호스트 빌드)
+// =======================================================
+// GCC 벡터 확장으로 4개씩 계산한다. 대상 CPU의 SIMD(SSE2/AVX/NEON)로 내려가고,
+// 연산 순서가 getDistanceSquared와 같아서 결과도 스칼라 계산과 비트 단위로 같다.
+#define LOCATION_BATCH 4
+
+typedef double batchDouble __attribute__((vector_size(sizeof(double) * LOCATION_BATCH)));
+typedef int32_t batchInt __attribute__((vector_size(sizeof(int32_t) * LOCATION_BATCH)));
+
+// 좌표 열 [k, k + n) 의 거리 제곱을 out에 쓴다.
+static void scoreDistances(int k, int n, double currentLat, double currentLon,
+                           double lonScale, double* out) {
+    const batchDouble unit = batchDouble{} + LOCATION_COORD_UNIT;
+    const batchDouble qLat = batchDouble{} + currentLat;
+    const batchDouble qLon = batchDouble{} + currentLon;
+    const batchDouble scale = batchDouble{} + lonScale;
+
+    int j = 0;
+    for (; j + LOCATION_BATCH <= n; j += LOCATION_BATCH) {
+        batchInt lat, lon;
+        memcpy(&lat, &locationSoaLat[k + j], sizeof(lat));
+        memcpy(&lon, &locationSoaLon[k + j], sizeof(lon));
+
+        batchDouble dLat = __builtin_convertvector(lat, batchDouble) * unit - qLat;
+        batchDouble dLon = (__builtin_convertvector(lon, batchDouble) * unit - qLon) * scale;
+        batchDouble d = dLat * dLat + dLon * dLon;
+        memcpy(&out[j], &d, sizeof(d));
+    }
+    for (; j < n; j++) {
+        out[j] = getDistanceSquared(locationSoaLat[k + j] * LOCATION_COORD_UNIT,
+                                    locationSoaLon[k + j] * LOCATION_COORD_UNIT,
+                                    currentLat, currentLon, lonScale);
+    }
+}
+
+// gridCellRows[first, last) 후보를 best에 넣는다.
+static void scanCandidates(int first, int last, double currentLat, double currentLon,
+                           double lonScale, NearestSet& best) {
+    double dist[64];
+    for (int k = first; k < last; k += 64) {
+        int n = last - k < 64 ? last - k : 64;
+        scoreDistances(k, n, currentLat, currentLon, lonScale, dist);
+
+        for (int j = 0; j < n; j++) {
+            if (dist[j] <= best.worst()) best.offer(dist[j], gridCellRows[k + j]);
+        }
+    }
+}
+#else
+// gridCellRows[first, last) 후보를 best에 넣는다.
+static void scanCandidates(int first, int last, double currentLat, double currentLon,
+                           double lonScale, NearestSet& best) {
+    for (int k = first; k < last; k++) {
+        int i = pgm_read_word(&gridCellRows[k]);
+
+        double centerLat = locationList[i].lat * LOCATION_COORD_UNIT;
+        double centerLon = locationList[i].lon * LOCATION_COORD_UNIT;
+
+        best.offer(getDistanceSquared(centerLat, centerLon, currentLat, currentLon, lonScale), i);
+    }
+}
+#endif // LOCATION_SOA
+
+// (gx, gy) 기준 반경 r 격자 테두리(정사각형 링)의 셀만 후보로 넣는다. r = 0이면 중심 셀.
+static void scanGridRing(int gx, int gy, int r, double currentLat, double currentLon,
+                         double lonScale, NearestSet& best) {
+    uint16_t first, last;
+    for (int x = gx - r; x <= gx + r; x++) {
+        if (x == gx - r || x == gx + r) {
+            if (findGridColumnRange(x, gy - r, gy + r, &first, &last))
+                scanCandidates(first, last, currentLat, currentLon, lonScale, best);
+        } else {
+            if (findGridColumnRange(x, gy - r, gy - r, &first, &last))
+                scanCandidates(first, last, currentLat, currentLon, lonScale, best);
+            if (findGridColumnRange(x, gy + r, gy + r, &first, &last))
+                scanCandidates(first, last, currentLat, currentLon, lonScale, best);
+        }
+    }
+}
+
+int findNearestRegion(int inputX, int inputY, double currentLat, double currentLon) {
+    NearestSet best = { 1, 0, {}, {} };
+    double lonScale = lonScaleAt(currentLat);
+
+    // 내 위치 기준 앞뒤 1칸(3x3 영역)의 버킷만 후보로 둡니다.
+    for (int gx = inputX - 1; gx <= inputX + 1; gx++) {
+        uint16_t first, last;
+        if (!findGridColumnRange(gx, inputY - 1, inputY + 1, &first, &last)) continue;
+        scanCandidates(first, last, currentLat, currentLon, lonScale, best);
+    }
+    return best.count > 0 ? best.row[0] : -1;
+}
+
+int findNearestRegions(double currentLat, double currentLon, int k, RegionMatch out[]) {
+    if (k <= 0) return 0;
+    if (k > REGION_MATCH_MAX) k = REGION_MATCH_MAX;
+
+    NearestSet best = { k, 0, {}, {} };
+    double lonScale = lonScaleAt(currentLat);
+    GridPoint p = changeToXY(currentLat, currentLon);
+
+    // 현재 격자에서 링을 넓혀 간다. 내 위치는 중심 셀 안(±0.5칸)에 있고 표의 격자값은
+    // 실제 위치와 최대 1칸 어긋나므로(gen_location.py 검사), 반경 r까지 본 뒤에는
+    // 그 밖의 지역이 최소 (r - 0.5)칸 떨어져 있다.
+    for (int r = 0; r <= REGION_SEARCH_RADIUS_MAX; r++) {
+        scanGridRing(p.x, p.y, r, currentLat, currentLon, lonScale, best);
+        if (best.count == k && distanceKm(best.worst()) <= (r - 0.5) * GRID) break;
+    }
+
+    for (int j = 0; j < best.count; j++) {
+        out[j].row = best.row[j];
+        out[j].distanceKm = distanceKm(best.dist[j]);
+    }
+    return best.count;
+}
+
+int findNearestRegionScan(double currentLat, double currentLon) {
+    NearestSet best = { 1, 0, {}, {} };
+    scanCandidates(0, locationCount, currentLat, currentLon, lonScaleAt(currentLat), best);
+    return best.count > 0 ? best.row[0] : -1;
+}
+
+// =======================================================
+// 위경도 -> 격자 + 가장 가까운 지역
+// =======================================================
+#ifdef LOCATION_RASTER
+// (lat, lon)이 들어 있는 래스터 런. 래스터 범위 밖이면 nullptr.
+static const LocationRasterRun* findRasterRun(double lat, double lon) {
+    const double step = LOCATION_RASTER_STEP * LOCATION_COORD_UNIT;
+    double fi = (lat - LOCATION_RASTER_LAT0 * LOCATION_COORD_UNIT) / step;
+    double fj = (lon - LOCATION_RASTER_LON0 * LOCATION_COORD_UNIT) / step;
+    if (!(fi >= 0.0 && fi < LOCATION_RASTER_LAT_COUNT)) return nullptr;
+    if (!(fj >= 0.0 && fj < LOCATION_RASTER_LON_COUNT)) return nullptr;
+
+    int i = (int)fi;
+    uint16_t j = (uint16_t)fj;
+
+    // 줄 i의 런 중 end > j 인 첫 런
+    uint32_t lo = pgm_read_dword(&locationRasterRowStart[i]);
+    uint32_t hi = pgm_read_dword(&locationRasterRowStart[i + 1]) - 1;
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (pgm_read_word(&locationRasterRuns[mid].end) <= j) lo = mid + 1;
+        else hi = mid;
+    }
+    return &locationRasterRuns[lo];
+}
+#endif // LOCATION_RASTER
+
+int locateRegion(double currentLat, double currentLon, GridPoint* cell) {
+#ifdef LOCATION_RASTER
+    const LocationRasterRun* run = findRasterRun(currentLat, currentLon);
+    if (run != nullptr) {
+        cell->x = pgm_read_byte(&run->gridX);
+        cell->y = pgm_read_byte(&run->gridY);
+        if (cell->x == 0) *cell = changeToXY(currentLat, currentLon);  // 격자 경계 칸
+
+        // 후보 중 내 격자 3x3 창 안에 있는 것만 findNearestRegion과 같은 규칙으로 비교
+        uint16_t set = pgm_read_word(&run->set);
+        uint32_t k1 = pgm_read_dword(&locationRasterSetStart[set + 1]);
+        NearestSet best = { 1, 0, {}, {} };
+        double lonScale = lonScaleAt(currentLat);
+        for (uint32_t k = pgm_read_dword(&locationRasterSetStart[set]); k < k1; k++) {
+            int i = pgm_read_word(&locationRasterSetRows[k]);
+            const LocationData& row = locationList[i];
+            if (abs(row.gridX - cell->x) > 1 || abs(row.gridY - cell->y) > 1) continue;
+            best.offer(getDistanceSquared(row.lat * LOCATION_COORD_UNIT, row.lon * LOCATION_COORD_UNIT,
+                                          currentLat, currentLon, lonScale), i);
+        }
+        return best.count > 0 ? best.row[0] : -1;
+    }
+#endif
+    *cell = changeToXY(currentLat, currentLon);
+    return findNearestRegion(cell->x, cell->y, currentLat, currentLon);
+}
@@ -0,0 +1,76 @@
+#ifndef REGION_H
+#define REGION_H
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "grid.h"
+
+// =============================
+// location.h 기반 지역 검색
+// =============================
+// 지역은 location.h 의 행 번호로 다룬다. 이름이 필요하면 getLocationName.
+
+#define LOCATION_NAME_BUF 80 // 지역 이름 버퍼 크기 (NUL 포함)
+
+// 행 번호의 전체 지역 이름을 buf에 쓴다.
+// snprintf처럼 size에 맞춰 자르고, 자르기 전 전체 길이를 돌려준다.
+size_t getLocationName(int row, char* buf, size_t size);
+
+// 이름으로 좌표 찾기 (location.h 내용과 정확히 동일한 이름)
+bool findXYByLocation(const char* inputName, int* outX, int* outY);
+
+// =============================
+// 이름 검색 (자동완성)
+// =============================
+#define REGION_SUGGEST_MAX 8  // 한 번에 돌려줄 수 있는 최대 후보 수
+
+// 공백으로 나눈 단어들로 지역을 찾아 좋은 순서로 최대 n개 행 번호를 rows에 채운다.
+// 각 단어는 이름 단계(시도 / 시군구 / 읍면동) 하나의 앞부분과 대소문자·'-' 구분 없이 맞아야 하고
+// ("gangbuk samyang" -> "Seoul Gangbuk-Gu Samyang-Dong"), 맞는 게 없으면 한 글자 오타까지 허용한다.
+int suggestLocations(const char* query, int rows[], int n);
+
+// 좌표로 이름 찾기 (그 격자의 대표 지역 이름)
+bool findLocationNameByXY(int gx, int gy, String &outName);
+
+// (gx, gy) 격자 칸에 속한 locationList 행 번호 목록 (PROGMEM).
+// rows[0]이 대표 지역이고, 개수를 돌려준다. 없으면 0.
+int findLocationRowsByXY(int gx, int gy, const uint16_t** rows);
+
+// 경도 1도 길이 / 위도 1도 길이 (= cos(lat))
+double lonScaleAt(double lat);
+
+// 위경도 거리 제곱 (후보 비교용, 단위 도²). 경도 차이에 lonScale을 곱한다.
+// lonScale = lonScaleAt(기준 위도)
+double getDistanceSquared(double lat1, double lon1, double lat2, double lon2, double lonScale);
+
+// 격자 주변 3x3 영역에서 현재 위경도와 가장 가까운 지역의 행 번호 (없으면 -1)
+int findNearestRegion(int inputX, int inputY, double currentLat, double currentLon);
+
+// 위경도 -> 격자 + 그 격자 주변에서 가장 가까운 지역 (changeToXY + findNearestRegion과 같은 결과)
+// 격자를 cell에 쓰고 지역 행 번호(없으면 -1)를 돌려준다.
+// LOCATION_RASTER 빌드에서는 미리 계산한 0.01° 래스터(location_raster.h)를 먼저 보고,
+// 칸 안에서 결과가 바뀌는 경계 칸이나 래스터 밖에서만 정확히 계산한다.
+int locateRegion(double currentLat, double currentLon, GridPoint* cell);
+
+// =============================
+// 가까운 지역 k개
+// =============================
+#define REGION_MATCH_MAX 16          // 한 번에 돌려줄 수 있는 최대 개수
+#define REGION_SEARCH_RADIUS_MAX 8   // 격자 링을 넓혀 가는 최대 반경 (칸, 약 40km)
+
+struct RegionMatch {
+  int row;           // location.h 행 번호
+  float distanceKm;  // 현재 위치와의 거리
+};
+
+// 현재 위경도에서 가까운 지역을 최대 k개 가까운 순서로 out에 채우고 개수를 돌려준다.
+// 격자 버킷 인덱스를 중심 셀부터 링 단위로 넓혀 가며 찾는다.
+int findNearestRegions(double currentLat, double currentLon, int k, RegionMatch out[]);
+
+// 격자 제한 없이 전체 지역 중 가장 가까운 행 번호 (오프라인 지오코딩용)
+// LOCATION_SOA 빌드에서는 좌표 열을 배치(SIMD)로 계산한다.
+int findNearestRegionScan(double currentLat, double currentLon);
+
+#endif // REGION_H
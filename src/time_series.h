@@ -0,0 +1,86 @@
+#ifndef TIME_SERIES_H
+#define TIME_SERIES_H
+
+#include <stdint.h>
+
+// =============================
+// 시간별 링 버퍼 시계열
+// =============================
+// 한 시간에 샘플 하나. 칸은 (hour % N)으로 정해지고 칸마다 시각을 샘플과 나란히 저장한다.
+// 새 시간이 와도 옮기는 것 없이 그 칸 하나만 덮어쓰고(O(1)), 이미 있는 시간은 다시 받을 필요가 없다.
+// hour: kmaHourIndex 값 (한국 시각 1970-01-01 00시부터의 시간 수)
+template <typename Sample, int N>
+class TimeSeries {
+public:
+  static const int capacity = N;
+
+  TimeSeries() { clear(); }
+
+  void clear() {
+    for (int i = 0; i < N; i++) slots_[i].hour = -1;
+    newest_ = -1;
+  }
+
+  // 가장 최근 시간보다 N시간 이상 오래된 샘플은 버린다.
+  void put(long hour, const Sample& s) {
+    if (hour < 0 || (newest_ >= 0 && hour <= newest_ - N)) return;
+    Slot& slot = slots_[slotOf(hour)];
+    slot.hour = (int32_t)hour;
+    slot.value = s;
+    if (hour > newest_) newest_ = hour;
+  }
+
+  // hour의 샘플 (없거나 N시간 전후의 다른 시간이 들어 있으면 nullptr)
+  const Sample* find(long hour) const {
+    if (hour < 0) return nullptr;
+    const Slot& slot = slots_[slotOf(hour)];
+    return slot.hour == hour ? &slot.value : nullptr;
+  }
+
+  bool get(long hour, Sample& out) const {
+    const Sample* s = find(hour);
+    if (s == nullptr) return false;
+    out = *s;
+    return true;
+  }
+
+  long newest() const { return newest_; }
+
+  // endHour부터 거꾸로 count시간 중 없는 시간 (비트 k = endHour - k), count <= 32
+  uint32_t missing(long endHour, int count) const {
+    uint32_t mask = 0;
+    for (int k = 0; k < count; k++) {
+      if (find(endHour - k) == nullptr) mask |= 1u << k;
+    }
+    return mask;
+  }
+
+  // [endHour - count + 1, endHour]를 오래된 시간부터 fn(i, 샘플 또는 nullptr)로 돈다. (i = 0 .. count-1)
+  // 칸이 시간 순서대로 붙어 있으므로 링 끝에서 한 번만 처음으로 돌아간다.
+  template <typename Fn>
+  void window(long endHour, int count, Fn fn) const {
+    long hour = endHour - count + 1;
+    int s = slotOf(hour);
+    for (int i = 0; i < count; i++, hour++) {
+      const Slot& slot = slots_[s];
+      fn(i, hour >= 0 && slot.hour == hour ? &slot.value : nullptr);
+      if (++s == N) s = 0;
+    }
+  }
+
+private:
+  struct Slot {
+    int32_t hour;  // -1이면 빈 칸
+    Sample value;
+  };
+
+  static int slotOf(long hour) {
+    int s = (int)(hour % N);
+    return s < 0 ? s + N : s;
+  }
+
+  Slot slots_[N];
+  long newest_;
+};
+
+#endif // TIME_SERIES_H
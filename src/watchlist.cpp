@@ -0,0 +1,73 @@
+#include "watchlist.h"
+
+static_assert(WATCHLIST_HOURS <= 16, "watchlistMissing returns a 16-bit mask");
+
+static WatchCell cells[WATCHLIST_SIZE];
+
+static void resetCell(int i) {
+  cells[i].nx = 0;
+  cells[i].ny = 0;
+  cells[i].series.clear();
+}
+
+int watchlistFind(int nx, int ny) {
+  for (int i = 0; i < WATCHLIST_SIZE; i++) {
+    if (cells[i].nx != 0 && cells[i].nx == nx && cells[i].ny == ny) return i;
+  }
+  return -1;
+}
+
+int watchlistAdd(int nx, int ny) {
+  int i = watchlistFind(nx, ny);
+  if (i >= 0) return i;
+
+  for (i = 0; i < WATCHLIST_SIZE; i++) {
+    if (cells[i].nx == 0) {
+      resetCell(i);
+      cells[i].nx = (uint8_t)nx;
+      cells[i].ny = (uint8_t)ny;
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool watchlistRemove(int nx, int ny) {
+  int i = watchlistFind(nx, ny);
+  if (i < 0) return false;
+  resetCell(i);
+  return true;
+}
+
+const WatchCell& watchlistAt(int i) {
+  return cells[i];
+}
+
+int watchlistCount() {
+  int n = 0;
+  for (int i = 0; i < WATCHLIST_SIZE; i++) {
+    if (cells[i].nx != 0) n++;
+  }
+  return n;
+}
+
+void watchlistStore(int i, long hour, const WeatherObs& obs) {
+  if (i < 0 || i >= WATCHLIST_SIZE || cells[i].nx == 0) return;
+  cells[i].series.put(hour, packObs(obs));
+}
+
+bool watchlistGet(int i, long hour, WeatherObs& out) {
+  if (i < 0 || i >= WATCHLIST_SIZE) return false;
+  const PackedObs* p = cells[i].series.find(hour);
+  if (p == nullptr) return false;
+  out = unpackObs(*p);
+  return true;
+}
+
+uint16_t watchlistMissing(int i, long nowHour) {
+  return (uint16_t)cells[i].series.missing(nowHour, WATCHLIST_HOURS);
+}
+
+void watchlistClear() {
+  for (int i = 0; i < WATCHLIST_SIZE; i++) resetCell(i);
+}
@@ -0,0 +1,46 @@
+#ifndef WATCHLIST_H
+#define WATCHLIST_H
+
+#include <stdint.h>
+
+#include "time_series.h"
+#include "weather.h"
+
+// =============================
+// 관심 지역 목록 (watchlist)
+// =============================
+// 화면에 보고 있는 지역과 따로, 격자 WATCHLIST_SIZE개를 정해 두고 같은 주기로 갱신한다.
+// 격자마다 WATCHLIST_HOURS시간짜리 링 버퍼(TimeSeries, 값은 PackedObs)를 가진다.
+// 메모리는 고정: WATCHLIST_SIZE x (WATCHLIST_HOURS x 12 B + 8 B)
+
+#ifndef WATCHLIST_SIZE
+#define WATCHLIST_SIZE 4     // 빌드 플래그로 바꿀 수 있음 (예: -D WATCHLIST_SIZE=8)
+#endif
+#define WATCHLIST_HOURS 12
+
+struct WatchCell {
+  uint8_t nx;                        // 0이면 빈 칸
+  uint8_t ny;
+  TimeSeries<PackedObs, WATCHLIST_HOURS> series;
+};
+
+// 추가 (이미 있으면 그 번호), 꽉 찼으면 -1
+int watchlistAdd(int nx, int ny);
+bool watchlistRemove(int nx, int ny);
+int watchlistFind(int nx, int ny);
+
+// 목록의 i번째 격자 (0 .. WATCHLIST_SIZE-1, 빈 칸이면 nx == 0)
+const WatchCell& watchlistAt(int i);
+int watchlistCount();
+
+// hour(kmaHourIndex)의 값 저장 / 읽기. 링보다 오래된 시간은 저장하지 않는다.
+// 저장할 때 PackedObs로 줄이므로 읽은 값은 0.1 단위(습도 1 %, 풍향 2°)로 반올림되어 있다.
+void watchlistStore(int i, long hour, const WeatherObs& obs);
+bool watchlistGet(int i, long hour, WeatherObs& out);
+
+// nowHour까지 WATCHLIST_HOURS시간 중 없는 시간 비트마스크 (비트 k = nowHour - k)
+uint16_t watchlistMissing(int i, long nowHour);
+
+void watchlistClear();
+
+#endif // WATCHLIST_H
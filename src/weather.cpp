@@ -0,0 +1,339 @@
+#include <Arduino.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "weather.h"
+
+// =============================
+// 스트리밍 파서
+// =============================
+// 값이 필요한 키만 고른다. (나머지 키의 값은 버퍼에 담지 않는다)
+KmaItemParser::Field KmaItemParser::fieldOf(const char* key, uint8_t len) {
+  if (len == 8 && memcmp(key, "category", 8) == 0) return FIELD_CATEGORY;
+  if (len == 9 && (memcmp(key, "obsrValue", 9) == 0 || memcmp(key, "fcstValue", 9) == 0)) return FIELD_VALUE;
+  if (len == 8 && memcmp(key, "fcstDate", 8) == 0) return FIELD_DATE;
+  if (len == 8 && memcmp(key, "fcstTime", 8) == 0) return FIELD_TIME;
+  return FIELD_NONE;
+}
+
+void KmaItemParser::reset() {
+  memset(&item_, 0, sizeof(item_));
+  hasValue_ = false;
+  len_ = 0;
+  objectMask_ = 0;
+  depth_ = 0;
+  itemDepth_ = 0;
+  state_ = EXPECT_VALUE;
+  field_ = FIELD_NONE;
+  escape_ = false;
+  done_ = false;
+  error_ = false;
+}
+
+size_t KmaItemParser::write(const uint8_t* buffer, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    // 문자열 안은 닫는 따옴표(또는 \\)까지 한 번에 넘긴다. 필요 없는 값(baseDate, resultMsg 등)은 담지 않는다.
+    if ((state_ == IN_STRING || state_ == IN_KEY) && !escape_) {
+      size_t j = i;
+      while (j < size && buffer[j] != '"' && buffer[j] != '\\') j++;
+      if (state_ == IN_KEY || field_ != FIELD_NONE) {
+        size_t n = j - i;
+        if (len_ + n < sizeof(buf_)) {
+          memcpy(buf_ + len_, buffer + i, n);
+          len_ += n;
+        } else if (state_ == IN_KEY) {
+          len_ = sizeof(buf_);                       // 너무 긴 키는 어떤 키와도 맞지 않게
+        } else {
+          memcpy(buf_ + len_, buffer + i, sizeof(buf_) - 1 - len_);
+          len_ = sizeof(buf_) - 1;                   // 긴 값은 잘라서
+        }
+      }
+      i = j;
+      if (i == size) break;
+    }
+    step((char)buffer[i]);
+  }
+  return size;
+}
+
+void KmaItemParser::openContainer(bool object) {
+  if (done_ || depth_ >= 32) { fail(); return; }
+  if (object) objectMask_ |= 1u << depth_;
+  else        objectMask_ &= ~(1u << depth_);
+  depth_++;
+
+  // item은 값을 가진 가장 안쪽 객체다. 지금 item에 아직 아무 값도 없을 때만 새 객체로 옮긴다.
+  // (item 안에 객체가 또 있으면 그 안의 키는 무시)
+  if (object && !item_.category[0] && !hasValue_ && !item_.fcstDate && !item_.fcstTime) {
+    itemDepth_ = depth_;
+  }
+  state_ = object ? EXPECT_KEY : EXPECT_VALUE;
+}
+
+void KmaItemParser::closeContainer(bool object) {
+  if (depth_ == 0 || ((objectMask_ >> (depth_ - 1)) & 1u) != (object ? 1u : 0u)) { fail(); return; }
+
+  if (object && depth_ == itemDepth_) {
+    if (item_.category[0] && hasValue_) onItem(item_);
+    memset(&item_, 0, sizeof(item_));
+    hasValue_ = false;
+  }
+
+  depth_--;
+  if (itemDepth_ > depth_) itemDepth_ = depth_;  // 바깥 객체의 나머지 키를 이어서 받는다
+  state_ = AFTER_VALUE;
+  if (depth_ == 0) done_ = true;
+}
+
+void KmaItemParser::endScalar() {
+  buf_[len_] = '\0';
+  switch (field_) {
+    case FIELD_CATEGORY:
+      strncpy(item_.category, buf_, sizeof(item_.category) - 1);
+      item_.category[sizeof(item_.category) - 1] = '\0';
+      break;
+    case FIELD_VALUE:
+      memcpy(item_.value, buf_, len_ + 1);
+      hasValue_ = true;
+      break;
+    case FIELD_DATE: item_.fcstDate = strtoul(buf_, nullptr, 10); break;
+    case FIELD_TIME: item_.fcstTime = (uint16_t)atoi(buf_); break;
+    default: break;
+  }
+  field_ = FIELD_NONE;
+  state_ = AFTER_VALUE;
+}
+
+void KmaItemParser::step(char c) {
+  if (error_) return;
+
+  switch (state_) {
+    case IN_KEY:
+    case IN_STRING:
+      if (escape_) {
+        escape_ = false;        // \" \\ \/ 는 그 글자로 (\n, \uXXXX 는 풀지 않음, 기상청 값에는 없다)
+      } else if (c == '\\') {
+        escape_ = true;
+        return;
+      } else if (c == '"') {
+        if (state_ == IN_KEY) {
+          field_ = depth_ == itemDepth_ ? fieldOf(buf_, len_) : FIELD_NONE;
+          state_ = AFTER_KEY;
+        } else {
+          endScalar();
+        }
+        return;
+      }
+      // 키는 비교에 필요한 만큼, 값은 고른 키의 것만 담는다.
+      if ((state_ == IN_KEY || field_ != FIELD_NONE) && len_ < sizeof(buf_) - 1) buf_[len_++] = c;
+      else if (state_ == IN_KEY) len_ = sizeof(buf_);  // 너무 긴 키는 어떤 키와도 맞지 않게
+      return;
+
+    case IN_LITERAL:
+      if (c != ',' && c != '}' && c != ']' && c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+        if (field_ != FIELD_NONE && len_ < sizeof(buf_) - 1) buf_[len_++] = c;
+        return;
+      }
+      endScalar();
+      break;  // 구분자는 아래에서 다시 처리
+
+    default:
+      break;
+  }
+
+  if (c == ' ' || c == '\n' || c == '\r' || c == '\t') return;
+
+  switch (state_) {
+    case EXPECT_KEY:
+      if (c == '"') { len_ = 0; state_ = IN_KEY; }
+      else if (c == '}') closeContainer(true);
+      else fail();
+      break;
+
+    case AFTER_KEY:
+      if (c == ':') state_ = EXPECT_VALUE;
+      else fail();
+      break;
+
+    case EXPECT_VALUE:
+      if (c == '{') openContainer(true);
+      else if (c == '[') openContainer(false);
+      else if (c == ']') closeContainer(false);  // 빈 배열
+      else if (c == '"') { len_ = 0; state_ = IN_STRING; }
+      else if (depth_ == 0 || c == ',' || c == '}' || c == ':') fail();
+      else {
+        len_ = 0;
+        if (field_ != FIELD_NONE) buf_[len_++] = c;
+        state_ = IN_LITERAL;
+      }
+      break;
+
+    case AFTER_VALUE:
+      if (c == ',' && depth_ > 0) {
+        field_ = FIELD_NONE;
+        state_ = ((objectMask_ >> (depth_ - 1)) & 1u) ? EXPECT_KEY : EXPECT_VALUE;
+      }
+      else if (c == '}') closeContainer(true);
+      else if (c == ']') closeContainer(false);
+      else fail();
+      break;
+
+    default:
+      break;
+  }
+}
+
+// =============================
+// 초단기실황 / 예보 파서
+// =============================
+NcstParser::NcstParser() {
+  obs_.T1H = obs_.REH = obs_.RN1 = obs_.WSD = obs_.VEC = NAN;
+}
+
+void NcstParser::onItem(const KmaItem& item) {
+  const char* cat = item.category;
+  float v = atof(item.value);
+
+  if(strcmp(cat,"T1H")==0) obs_.T1H=v;
+  if(strcmp(cat,"REH")==0) obs_.REH=v;
+  if(strcmp(cat,"RN1")==0) obs_.RN1=v;
+  if(strcmp(cat,"WSD")==0) obs_.WSD=v;
+  if(strcmp(cat,"VEC")==0) obs_.VEC=v;
+}
+
+bool NcstParser::finish(WeatherObs& obs) const {
+  obs = obs_;
+  return complete() && !isnan(obs.T1H) && !isnan(obs.REH);
+}
+
+ForecastParser::ForecastParser(uint32_t startDate, uint16_t startTime, int hours, WeatherObs out[])
+  : start_(kmaHourIndex(startDate, startTime)), hours_(hours), out_(out) {
+  for(int i=0;i<hours;i++){
+    out[i].T1H=out[i].REH=out[i].RN1=out[i].WSD=out[i].VEC=NAN;
+  }
+}
+
+void ForecastParser::onItem(const KmaItem& item) {
+  if (item.fcstDate == 0) return;
+
+  long slot = kmaHourIndex(item.fcstDate, item.fcstTime) - start_;
+  if(slot < 0 || slot >= hours_) return;
+
+  const char* cat = item.category;
+  const char* value = item.value;
+  WeatherObs& w = out_[slot];
+  if(strcmp(cat,"TMP")==0 || strcmp(cat,"T1H")==0) w.T1H=atof(value);
+  if(strcmp(cat,"REH")==0) w.REH=atof(value);
+  if(strcmp(cat,"PCP")==0 || strcmp(cat,"RN1")==0) w.RN1=parsePrecipitation(value);
+  if(strcmp(cat,"WSD")==0) w.WSD=atof(value);
+  if(strcmp(cat,"VEC")==0) w.VEC=atof(value);
+}
+
+int ForecastParser::finish() const {
+  if (!complete()) return 0;
+  int filled = 0;
+  for(int i=0;i<hours_;i++){
+    if(!isnan(out_[i].T1H) && !isnan(out_[i].REH)) filled++;
+  }
+  return filled;
+}
+
+// =============================
+// JSON 파싱 (받아 둔 본문)
+// =============================
+bool extractWeather(const String& json,
+                    float &T1H, float &REH,
+                    float &RN1, float &WSD, float &VEC){
+  NcstParser parser;
+  parser.write((const uint8_t*)json.c_str(), json.length());
+
+  WeatherObs obs;
+  bool ok = parser.finish(obs);
+  if(!parser.complete()) Serial.println("JSON error: incomplete or malformed response");
+
+  T1H=obs.T1H; REH=obs.REH; RN1=obs.RN1; WSD=obs.WSD; VEC=obs.VEC;
+  return ok;
+}
+
+int extractForecastSeries(const String& json, uint32_t startDate, uint16_t startTime,
+                          int hours, WeatherObs out[]){
+  ForecastParser parser(startDate, startTime, hours, out);
+  parser.write((const uint8_t*)json.c_str(), json.length());
+  if(!parser.complete()) Serial.println("JSON error: incomplete or malformed response");
+  return parser.finish();
+}
+
+// =============================
+// 기록용 압축 (PackedObs)
+// =============================
+#define PACK_NONE_T   INT16_MIN
+#define PACK_NONE_U8  0xFF
+#define PACK_NONE_U16 0xFFFF
+
+// v * scale을 반올림해서 [lo, hi]로 자른다. NAN이면 none.
+static long quantize(float v, float scale, long lo, long hi, long none) {
+  if (isnan(v)) return none;
+  long q = lroundf(v * scale);
+  return q < lo ? lo : q > hi ? hi : q;
+}
+
+PackedObs packObs(const WeatherObs& obs) {
+  PackedObs p;
+  p.t10   = (int16_t)quantize(obs.T1H, 10.0f, INT16_MIN + 1, INT16_MAX, PACK_NONE_T);
+  p.rn10  = (uint16_t)quantize(obs.RN1, 10.0f, 0, PACK_NONE_U16 - 1, PACK_NONE_U16);
+  p.reh   = (uint8_t)quantize(obs.REH, 1.0f, 0, 100, PACK_NONE_U8);
+  p.wsd10 = (uint8_t)quantize(obs.WSD, 10.0f, 0, PACK_NONE_U8 - 1, PACK_NONE_U8);
+  if (isnan(obs.VEC)) {
+    p.vec2 = PACK_NONE_U8;
+  } else {
+    long d = lroundf(obs.VEC * 0.5f) % 180;   // 360° = 0°
+    p.vec2 = (uint8_t)(d < 0 ? d + 180 : d);
+  }
+  return p;
+}
+
+WeatherObs unpackObs(const PackedObs& p) {
+  WeatherObs obs;
+  obs.T1H = p.t10   == PACK_NONE_T   ? NAN : p.t10 / 10.0f;
+  obs.RN1 = p.rn10  == PACK_NONE_U16 ? NAN : p.rn10 / 10.0f;
+  obs.REH = p.reh   == PACK_NONE_U8  ? NAN : (float)p.reh;
+  obs.WSD = p.wsd10 == PACK_NONE_U8  ? NAN : p.wsd10 / 10.0f;
+  obs.VEC = p.vec2  == PACK_NONE_U8  ? NAN : p.vec2 * 2.0f;
+  return obs;
+}
+
+// =============================
+// 예보 시각 / 강수량
+// =============================
+long kmaHourIndex(uint32_t date, uint16_t time) {
+  // 그레고리력 날짜 -> 1970-01-01부터의 일 수 (days_from_civil)
+  long y = date / 10000;
+  long m = (date / 100) % 100;
+  long d = date % 100;
+  y -= m <= 2;
+  long era = (y >= 0 ? y : y - 399) / 400;
+  long yoe = y - era * 400;
+  long doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  long days = era * 146097 + doe - 719468;
+  return days * 24 + time / 100;
+}
+
+float parsePrecipitation(const char* s) {
+  if (s == nullptr || *s == '\0') return NAN;
+  if (strstr(s, "없음")) return 0.0f;
+
+  char* end;
+  float v = strtof(s, &end);
+  if (end == s) return NAN;
+  if (strstr(s, "미만")) return v * 0.5f;         // "1mm 미만"
+
+  const char* tilde = strchr(end, '~');
+  if (tilde) {                                     // "30.0~50.0mm"
+    float hi = strtof(tilde + 1, nullptr);
+    return (v + hi) * 0.5f;
+  }
+  return v;                                        // "1.0mm", "50.0mm 이상"
+}
@@ -0,0 +1,146 @@
+#ifndef WEATHER_H
+#define WEATHER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+// 한 시간치 관측(또는 예보) 값
+struct WeatherObs {
+  float T1H;  // 기온 (°C)
+  float REH;  // 습도 (%)
+  float RN1;  // 1시간 강수량 (mm)
+  float WSD;  // 풍속 (m/s)
+  float VEC;  // 풍향 (deg)
+};
+
+// 기록용으로 줄인 한 시간치 값 (8 B, float 5개는 20 B)
+// 기온 0.1 °C, 습도 1 %, 강수 0.1 mm, 풍속 0.1 m/s(최대 25.4), 풍향 2° 단위
+// 범위를 넘으면 끝값으로 자르고, 없는 값(NAN)은 각 필드의 최댓값(기온은 최솟값)으로 표시한다.
+struct PackedObs {
+  int16_t t10;    // 기온 x10
+  uint16_t rn10;  // 강수량 x10
+  uint8_t reh;    // 습도
+  uint8_t wsd10;  // 풍속 x10
+  uint8_t vec2;   // 풍향 / 2 (0 .. 179)
+};
+
+PackedObs packObs(const WeatherObs& obs);
+WeatherObs unpackObs(const PackedObs& p);
+
+// =============================
+// 기상청 응답 스트리밍 파서
+// =============================
+// JSON을 받는 대로 한 바이트씩 읽어서 item 객체의 category와 값만 꺼낸다.
+// 응답 전체를 String이나 JsonDocument로 만들지 않으므로 응답 크기와 상관없이 메모리가 일정하다.
+// Stream을 상속하므로 http.writeToStream(&parser)로 연결에서 바로 받을 수 있다.
+struct KmaItem {
+  char category[8];    // "T1H", "TMP", ...
+  char value[24];      // obsrValue 또는 fcstValue (문자열 그대로, 길면 잘림)
+  uint32_t fcstDate;   // YYYYMMDD (실황이면 0)
+  uint16_t fcstTime;   // HHMM
+};
+
+class KmaItemParser : public Stream {
+public:
+  KmaItemParser() { reset(); }
+
+  void reset();
+
+  size_t write(uint8_t c) override { step((char)c); return 1; }
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  // 받는 쪽 전용이라 읽을 것은 없다.
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+
+  // 최상위 객체가 문법 오류 없이 끝까지 닫혔는지
+  bool complete() const { return done_ && !error_; }
+
+protected:
+  virtual void onItem(const KmaItem& item) = 0;
+
+private:
+  enum State : uint8_t { EXPECT_VALUE, EXPECT_KEY, IN_KEY, AFTER_KEY, IN_STRING, IN_LITERAL, AFTER_VALUE };
+  enum Field : uint8_t { FIELD_NONE, FIELD_CATEGORY, FIELD_VALUE, FIELD_DATE, FIELD_TIME };
+
+  static Field fieldOf(const char* key, uint8_t len);
+  void step(char c);
+  void openContainer(bool object);
+  void closeContainer(bool object);
+  void endScalar();
+  void fail() { error_ = true; }
+
+  KmaItem item_;
+  bool hasValue_;
+  char buf_[sizeof(KmaItem::value)];  // 지금 읽는 키 또는 값
+  uint8_t len_;
+  uint32_t objectMask_;               // 깊이별로 객체(1)/배열(0)
+  uint8_t depth_;
+  uint8_t itemDepth_;                 // item_을 채우는 객체의 깊이
+  State state_;
+  Field field_;
+  bool escape_;
+  bool done_;
+  bool error_;
+};
+
+// 초단기실황(getUltraSrtNcst): T1H, REH, RN1, WSD, VEC
+class NcstParser : public KmaItemParser {
+public:
+  NcstParser();
+  // 문서가 온전하고 T1H, REH 둘 다 있어야 true
+  bool finish(WeatherObs& obs) const;
+
+protected:
+  void onItem(const KmaItem& item) override;
+
+private:
+  WeatherObs obs_;
+};
+
+// 단기예보(getVilageFcst) / 초단기예보(getUltraSrtFcst): 여러 시간
+// startDate/startTime(YYYYMMDD, HHMM)부터 hours시간치를 out[0 .. hours-1]에 채운다. 없는 값은 NAN.
+// 카테고리: TMP/T1H -> T1H, REH, PCP/RN1 -> RN1, WSD, VEC
+class ForecastParser : public KmaItemParser {
+public:
+  ForecastParser(uint32_t startDate, uint16_t startTime, int hours, WeatherObs out[]);
+  // 기온과 습도가 다 있는 칸 수 (문서가 깨졌으면 0)
+  int finish() const;
+
+protected:
+  void onItem(const KmaItem& item) override;
+
+private:
+  long start_;
+  int hours_;
+  WeatherObs* out_;
+};
+
+// =============================
+// 기상청 초단기실황(getUltraSrtNcst) 응답 파싱
+// =============================
+// 이미 받아 둔 본문용 (NcstParser에 통째로 넣는다)
+// T1H(기온), REH(습도), RN1(1시간 강수량), WSD(풍속), VEC(풍향)을 꺼낸다.
+// T1H, REH 둘 다 있어야 성공으로 본다.
+bool extractWeather(const String& json,
+                    float &T1H, float &REH,
+                    float &RN1, float &WSD, float &VEC);
+
+// =============================
+// 단기예보(getVilageFcst) / 초단기예보(getUltraSrtFcst) 응답 파싱
+// =============================
+// 이미 받아 둔 본문용 (ForecastParser에 통째로 넣는다)
+// 기온과 습도가 다 있는 칸 수를 돌려준다.
+int extractForecastSeries(const String& json, uint32_t startDate, uint16_t startTime,
+                          int hours, WeatherObs out[]);
+
+// 예보 강수량 문자열 -> mm
+// "강수없음" 0, "1mm 미만" 0.5, "1.0mm" 1, "30.0~50.0mm" 40(가운데), "50.0mm 이상" 50
+float parsePrecipitation(const char* s);
+
+// YYYYMMDD, HHMM -> 1970-01-01 00시부터의 시간 수 (두 시각의 시간 차이 계산용)
+long kmaHourIndex(uint32_t date, uint16_t time);
+
+#endif // WEATHER_H
@@ -0,0 +1,161 @@
+"""기상청 API Hub 대체 서버 (VilageFcstInfoService_2.0, JSON).
+
+실제 서버 대신 기기나 호스트에서 요청 흐름을 확인할 때 쓴다. 값은 격자와 시각으로 정해지는
+가짜 날씨라서 같은 요청에는 항상 같은 응답이 온다. HTTP/1.1 keep-alive를 지원한다.
+
+    python3 test/kma_stub/kma_stub_server.py --port 8080
+
+펌웨어는 -D KMA_HOST='"http://<이 PC의 IP>:8080"' 로 빌드한다.
+
+지원: getUltraSrtNcst(초단기실황), getUltraSrtFcst(초단기예보 6시간), getVilageFcst(단기예보)
+numOfRows, pageNo, base_date, base_time, nx, ny
+"""
+
+import argparse
+import json
+import math
+from datetime import datetime, timedelta
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+PREFIX = "/api/typ02/openApi/VilageFcstInfoService_2.0/"
+
+VILAGE_HOURS = 24
+ULTRA_HOURS = 6
+
+
+def weather_at(nx, ny, when):
+    """격자 (nx, ny)의 시각 when(정시) 날씨."""
+    h = when.hour + when.day * 24
+    seed = (nx * 31 + ny * 17) % 11
+    temp = 12.0 + 6.0 * math.sin(2 * math.pi * (when.hour - 9) / 24) + seed * 0.3
+    reh = 60 - 25 * math.sin(2 * math.pi * (when.hour - 9) / 24) + seed
+    rain = [0.0, 0.0, 0.0, 0.5, 1.2, 3.0, 0.0, 0.0][(h + seed) % 8]
+    wsd = 1.0 + ((h * 7 + seed) % 40) / 10.0
+    vec = (h * 37 + seed * 29) % 360
+    return {
+        "T1H": round(temp, 1),
+        "REH": int(round(reh)),
+        "RN1": rain,
+        "WSD": round(wsd, 1),
+        "VEC": vec,
+    }
+
+
+def precipitation_text(mm):
+    """단기예보 PCP 문자열 형식."""
+    if mm <= 0:
+        return "강수없음"
+    if mm < 1.0:
+        return "1mm 미만"
+    if mm >= 50.0:
+        return "50.0mm 이상"
+    if mm >= 30.0:
+        return "30.0~50.0mm"
+    return f"{mm:.1f}mm"
+
+
+def ncst_items(base, nx, ny):
+    w = weather_at(nx, ny, base)
+    items = []
+    for cat in ("PTY", "REH", "RN1", "T1H", "UUU", "VEC", "VVV", "WSD"):
+        value = w.get(cat, 0)
+        items.append({
+            "baseDate": base.strftime("%Y%m%d"), "baseTime": base.strftime("%H%M"),
+            "category": cat, "nx": nx, "ny": ny, "obsrValue": str(value),
+        })
+    return items
+
+
+def fcst_items(base, nx, ny, hours, categories, rename):
+    items = []
+    for i in range(1, hours + 1):
+        when = base + timedelta(hours=i)
+        w = weather_at(nx, ny, when)
+        for cat in categories:
+            src = rename.get(cat, cat)
+            if src == "RN1":
+                value = precipitation_text(w["RN1"])
+            elif src in w:
+                value = str(w[src])
+            else:
+                value = "0"
+            items.append({
+                "baseDate": base.strftime("%Y%m%d"), "baseTime": base.strftime("%H%M"),
+                "category": cat,
+                "fcstDate": when.strftime("%Y%m%d"), "fcstTime": when.strftime("%H%M"),
+                "fcstValue": value, "nx": nx, "ny": ny,
+            })
+    return items
+
+
+def build_response(operation, query):
+    def arg(name, default=None):
+        return query.get(name, [default])[0]
+
+    try:
+        base = datetime.strptime(arg("base_date") + arg("base_time")[:2], "%Y%m%d%H")
+        nx, ny = int(arg("nx")), int(arg("ny"))
+        rows = int(arg("numOfRows", "10"))
+        page = int(arg("pageNo", "1"))
+    except (TypeError, ValueError):
+        return header_only("10", "INVALID_REQUEST_PARAMETER_ERROR")
+
+    if operation == "getUltraSrtNcst":
+        items = ncst_items(base, nx, ny)
+    elif operation == "getUltraSrtFcst":
+        items = fcst_items(base, nx, ny, ULTRA_HOURS,
+                           ("LGT", "PTY", "RN1", "SKY", "T1H", "REH", "UUU", "VVV", "VEC", "WSD"), {})
+    elif operation == "getVilageFcst":
+        if base.hour % 3 != 2:
+            return header_only("03", "NO_DATA")
+        items = fcst_items(base, nx, ny, VILAGE_HOURS,
+                           ("TMP", "UUU", "VVV", "VEC", "WSD", "SKY", "PTY", "POP", "WAV", "PCP", "REH", "SNO"),
+                           {"TMP": "T1H", "PCP": "RN1"})
+    else:
+        return None
+
+    page_items = items[(page - 1) * rows: page * rows]
+    if not page_items:
+        return header_only("03", "NO_DATA")
+    return {"response": {
+        "header": {"resultCode": "00", "resultMsg": "NORMAL_SERVICE"},
+        "body": {"dataType": "JSON", "items": {"item": page_items},
+                 "pageNo": page, "numOfRows": rows, "totalCount": len(items)},
+    }}
+
+
+def header_only(code, msg):
+    return {"response": {"header": {"resultCode": code, "resultMsg": msg}}}
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"   # keep-alive: 펌웨어의 http.setReuse(true)와 같이 확인
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        if not url.path.startswith(PREFIX):
+            self.send_error(404)
+            return
+        doc = build_response(url.path[len(PREFIX):], parse_qs(url.query))
+        if doc is None:
+            self.send_error(404)
+            return
+        body = json.dumps(doc, ensure_ascii=False).encode("utf-8")
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json;charset=UTF-8")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8080)
+    args = parser.parse_args()
+    ThreadingHTTPServer((args.host, args.port), Handler).serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,71 @@
+// 호스트(native) 빌드용 Arduino.h 대체 헤더
+// 위치/투영/파싱 코드를 보드 없이 빌드하기 위한 최소한의 API만 제공한다.
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <ctype.h>
+#include <chrono>
+#include <thread>
+
+#include "pgmspace.h"
+#include "Stream.h"
+#include "WString.h"
+
+#define HIGH 0x1
+#define LOW  0x0
+
+inline unsigned long millis() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (unsigned long)duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long micros() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (unsigned long)duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline bool isDigit(int c) { return isdigit(c) != 0; }
+
+// Serial: 표준 출력으로 보내고, 입력은 없는 것으로 취급한다.
+class NativeSerial {
+public:
+  void begin(unsigned long) {}
+  int available() { return 0; }
+  String readStringUntil(char) { return String(); }
+
+  size_t print(const String& s) { return fputs(s.c_str(), stdout) >= 0 ? s.length() : 0; }
+  size_t print(const char* s) { return fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+  size_t print(char c) { return putchar(c) == EOF ? 0 : 1; }
+  size_t print(int v) { return ::printf("%d", v); }
+  size_t print(long v) { return ::printf("%ld", v); }
+  size_t print(unsigned int v) { return ::printf("%u", v); }
+  size_t print(unsigned long v) { return ::printf("%lu", v); }
+  size_t print(double v, int dec = 2) { return ::printf("%.*f", dec, v); }
+
+  template <typename T>
+  size_t println(const T& v) { size_t n = print(v); return n + print('\n'); }
+  size_t println(double v, int dec) { size_t n = print(v, dec); return n + print('\n'); }
+  size_t println() { return print('\n'); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n < 0 ? 0 : (size_t)n;
+  }
+};
+
+inline NativeSerial Serial;
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,28 @@
+// 호스트(native) 빌드용 Print/Stream 대체 헤더
+// 파서처럼 Stream을 상속해서 바이트를 받는 클래스를 빌드하기 위한 가상 함수만 있다.
+#ifndef NATIVE_STREAM_H
+#define NATIVE_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+};
+
+#endif // NATIVE_STREAM_H
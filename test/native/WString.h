@@ -0,0 +1,110 @@
+// 호스트(native) 빌드용 Arduino String 대체 클래스
+// 실제 Arduino 구현처럼 malloc/realloc으로 버퍼를 관리한다.
+// (벤치마크의 할당 횟수가 펌웨어와 비슷하게 나오도록)
+#ifndef NATIVE_WSTRING_H
+#define NATIVE_WSTRING_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+class String {
+public:
+  String(const char* s = "") { assign(s, strlen(s)); }
+  String(const String& o) { assign(o.buf_, o.len_); }
+  String(String&& o) : buf_(o.buf_), len_(o.len_), cap_(o.cap_) {
+    o.buf_ = nullptr; o.len_ = o.cap_ = 0;
+  }
+  explicit String(char c) { assign(&c, 1); }
+  explicit String(int v) { char b[16]; snprintf(b, sizeof(b), "%d", v); assign(b, strlen(b)); }
+  explicit String(long v) { char b[24]; snprintf(b, sizeof(b), "%ld", v); assign(b, strlen(b)); }
+  explicit String(unsigned int v) { char b[16]; snprintf(b, sizeof(b), "%u", v); assign(b, strlen(b)); }
+  explicit String(unsigned long v) { char b[24]; snprintf(b, sizeof(b), "%lu", v); assign(b, strlen(b)); }
+  explicit String(double v, unsigned char dec = 2) {
+    char b[40]; snprintf(b, sizeof(b), "%.*f", dec, v); assign(b, strlen(b));
+  }
+  ~String() { free(buf_); }
+
+  String& operator=(const String& o) { if (this != &o) assign(o.buf_, o.len_); return *this; }
+  String& operator=(String&& o) {
+    if (this != &o) {
+      free(buf_);
+      buf_ = o.buf_; len_ = o.len_; cap_ = o.cap_;
+      o.buf_ = nullptr; o.len_ = o.cap_ = 0;
+    }
+    return *this;
+  }
+  String& operator=(const char* s) { assign(s, strlen(s)); return *this; }
+
+  String& operator+=(const String& o) { return append(o.c_str(), o.len_); }
+  String& operator+=(const char* s) { return append(s, strlen(s)); }
+  String& operator+=(char c) { return append(&c, 1); }
+  String& operator+=(int v) { return *this += String(v); }
+
+  friend String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+  friend String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+  friend String operator+(const String& a, int b) { String r(a); r += b; return r; }
+
+  bool operator==(const String& o) const { return strcmp(c_str(), o.c_str()) == 0; }
+  bool operator==(const char* s) const { return strcmp(c_str(), s) == 0; }
+  bool operator!=(const String& o) const { return !(*this == o); }
+  bool operator!=(const char* s) const { return !(*this == s); }
+
+  char operator[](unsigned int i) const { return i < len_ ? buf_[i] : 0; }
+
+  const char* c_str() const { return buf_ ? buf_ : ""; }
+  unsigned int length() const { return len_; }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    for (unsigned int i = from; i < len_; i++) if (buf_[i] == c) return (int)i;
+    return -1;
+  }
+  String substring(unsigned int from) const { return substring(from, len_); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (to > len_) to = len_;
+    if (from > to) from = to;
+    String r;
+    r.assign(c_str() + from, to - from);
+    return r;
+  }
+  void trim() {
+    unsigned int b = 0, e = len_;
+    while (b < e && isspace((unsigned char)buf_[b])) b++;
+    while (e > b && isspace((unsigned char)buf_[e - 1])) e--;
+    if (b > 0) memmove(buf_, buf_ + b, e - b);
+    len_ = e - b;
+    if (buf_) buf_[len_] = 0;
+  }
+  long toInt() const { return atol(c_str()); }
+  float toFloat() const { return (float)atof(c_str()); }
+
+private:
+  bool reserve(unsigned int n) {
+    if (n <= cap_ && buf_) return true;
+    char* p = (char*)realloc(buf_, n + 1);
+    if (!p) return false;
+    buf_ = p; cap_ = n;
+    return true;
+  }
+  void assign(const char* s, unsigned int n) {
+    if (!reserve(n)) return;
+    memmove(buf_, s, n);
+    len_ = n;
+    buf_[len_] = 0;
+  }
+  String& append(const char* s, unsigned int n) {
+    if (!reserve(len_ + n)) return *this;
+    memmove(buf_ + len_, s, n);
+    len_ += n;
+    buf_[len_] = 0;
+    return *this;
+  }
+
+  char* buf_ = nullptr;
+  unsigned int len_ = 0;
+  unsigned int cap_ = 0;
+};
+
+#endif // NATIVE_WSTRING_H
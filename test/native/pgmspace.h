@@ -0,0 +1,25 @@
+// 호스트(native) 빌드용 pgmspace.h 대체 헤더
+// ESP32와 마찬가지로 PROGMEM 데이터도 일반 메모리처럼 직접 읽을 수 있다.
+#ifndef NATIVE_PGMSPACE_H
+#define NATIVE_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+#define pgm_read_ptr(addr)   (*(const void* const*)(addr))
+
+#define memcpy_P  memcpy
+#define strcpy_P  strcpy
+#define strcmp_P  strcmp
+#define strncmp_P strncmp
+#define strlen_P  strlen
+
+#endif // NATIVE_PGMSPACE_H
@@ -0,0 +1,51 @@
+// =============================
+// native 벤치마크 도우미
+// =============================
+// - ns/op : steady_clock 기준, 반복 횟수로 나눈 평균
+// - allocs/op : malloc 계열을 가로채서 센 힙 할당 횟수 평균 (bench_alloc.cpp)
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+namespace bench {
+
+extern uint64_t allocCount;
+
+struct Result {
+  double nsPerOp;
+  double allocsPerOp;
+};
+
+// 최적화로 결과 계산이 지워지지 않도록 막는다.
+template <typename T>
+inline void keep(const T& v) {
+  asm volatile("" : : "g"(&v) : "memory");
+}
+
+// opsPerCall: fn 한 번이 여러 건을 처리할 때(배치) 건당 수치로 나눈다.
+template <typename Fn>
+Result run(const char* name, long iterations, Fn fn, long opsPerCall = 1) {
+  // 워밍업 (캐시/분기 예측 안정화)
+  for (long i = 0; i < iterations / 10 + 1; i++) fn(i);
+
+  uint64_t allocBefore = allocCount;
+  auto t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++) fn(i);
+  auto t1 = std::chrono::steady_clock::now();
+  uint64_t allocs = allocCount - allocBefore;
+
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+  long ops = iterations * opsPerCall;
+  Result r = { ns / ops, (double)allocs / ops };
+  printf("BENCH %-32s %12.1f ns/op %8.2f allocs/op  (n=%ld)\n",
+         name, r.nsPerOp, r.allocsPerOp, ops);
+  return r;
+}
+
+} // namespace bench
+
+#endif // BENCH_H
@@ -0,0 +1,71 @@
+// malloc 계열을 덮어써서 힙 할당 횟수를 센다. (operator new도 malloc을 거친다)
+// glibc는 __libc_malloc 등으로, 그 밖(macOS 등)은 dlsym(RTLD_NEXT)로 찾은 원래 함수로 넘긴다.
+#include <stdlib.h>
+
+#include "bench.h"
+
+namespace bench {
+uint64_t allocCount = 0;
+}
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void  __libc_free(void*);
+}
+
+static void* realMalloc(size_t n) { return __libc_malloc(n); }
+static void* realCalloc(size_t n, size_t size) { return __libc_calloc(n, size); }
+static void* realRealloc(void* p, size_t n) { return __libc_realloc(p, n); }
+static void realFree(void* p) { __libc_free(p); }
+#else
+#include <dlfcn.h>
+
+template <typename Fn>
+static Fn next(Fn& cached, const char* name) {
+  if (cached == nullptr) cached = (Fn)dlsym(RTLD_NEXT, name);
+  return cached;
+}
+
+static void* realMalloc(size_t n) {
+  static void* (*fn)(size_t) = nullptr;
+  return next(fn, "malloc")(n);
+}
+static void* realCalloc(size_t n, size_t size) {
+  static void* (*fn)(size_t, size_t) = nullptr;
+  return next(fn, "calloc")(n, size);
+}
+static void* realRealloc(void* p, size_t n) {
+  static void* (*fn)(void*, size_t) = nullptr;
+  return next(fn, "realloc")(p, n);
+}
+static void realFree(void* p) {
+  static void (*fn)(void*) = nullptr;
+  next(fn, "free")(p);
+}
+#endif
+
+extern "C" {
+
+void* malloc(size_t n) {
+  bench::allocCount++;
+  return realMalloc(n);
+}
+
+void* calloc(size_t n, size_t size) {
+  bench::allocCount++;
+  return realCalloc(n, size);
+}
+
+void* realloc(void* p, size_t n) {
+  bench::allocCount++;
+  return realRealloc(p, n);
+}
+
+void free(void* p) {
+  realFree(p);
+}
+
+}
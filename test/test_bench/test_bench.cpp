@@ -0,0 +1,978 @@
+// =============================
+// 위치/투영/파싱 마이크로 벤치마크 (native)
+// =============================
+// 실행: pio test -e native -f test_bench -v
+// 각 항목의 ns/op, allocs/op를 출력한다. 성능 관련 변경은 이 수치와 비교할 것.
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+
+#include "bench.h"
+#include "fetch_sched.h"
+#include "frame_diff.h"
+#include "grid.h"
+#include "history_log.h"
+#include "location.h"
+#include "obs_cache.h"
+#include "region.h"
+#include "time_series.h"
+#include "watchlist.h"
+#include "weather.h"
+
+// 초단기실황(getUltraSrtNcst) 실제 응답 형식의 예시 (서울 60,127)
+static const char* ncstSampleJson =
+  "{\"response\":{\"header\":{\"resultCode\":\"00\",\"resultMsg\":\"NORMAL_SERVICE\"},"
+  "\"body\":{\"dataType\":\"JSON\",\"items\":{\"item\":["
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"PTY\",\"nx\":60,\"ny\":127,\"obsrValue\":\"0\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"REH\",\"nx\":60,\"ny\":127,\"obsrValue\":\"71\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"RN1\",\"nx\":60,\"ny\":127,\"obsrValue\":\"0\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"T1H\",\"nx\":60,\"ny\":127,\"obsrValue\":\"-3.2\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"UUU\",\"nx\":60,\"ny\":127,\"obsrValue\":\"0.9\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"VEC\",\"nx\":60,\"ny\":127,\"obsrValue\":\"265\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"VVV\",\"nx\":60,\"ny\":127,\"obsrValue\":\"0.1\"},"
+  "{\"baseDate\":\"20250101\",\"baseTime\":\"0600\",\"category\":\"WSD\",\"nx\":60,\"ny\":127,\"obsrValue\":\"1.1\"}"
+  "]},\"pageNo\":1,\"numOfRows\":60,\"totalCount\":8}}}";
+
+// 단기예보(getVilageFcst) 응답 형식의 예시 (2024-12-31 20시 발표, 일부만)
+// 00시는 REH가 빠져 있다.
+static const char* vilageSampleJson =
+  "{\"response\":{\"header\":{\"resultCode\":\"00\",\"resultMsg\":\"NORMAL_SERVICE\"},"
+  "\"body\":{\"dataType\":\"JSON\",\"items\":{\"item\":["
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"TMP\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2100\",\"fcstValue\":\"-0.5\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"TMP\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2200\",\"fcstValue\":\"-1.0\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"REH\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2200\",\"fcstValue\":\"65\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"PCP\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2200\",\"fcstValue\":\"강수없음\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"WSD\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2200\",\"fcstValue\":\"2.1\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"VEC\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2200\",\"fcstValue\":\"300\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"SKY\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2200\",\"fcstValue\":\"1\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"TMP\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2300\",\"fcstValue\":\"-1.5\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"REH\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2300\",\"fcstValue\":\"70\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"PCP\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2300\",\"fcstValue\":\"1mm 미만\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"WSD\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2300\",\"fcstValue\":\"2.4\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"VEC\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2300\",\"fcstValue\":\"310\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"SKY\",\"fcstDate\":\"20241231\",\"fcstTime\":\"2300\",\"fcstValue\":\"4\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"TMP\",\"fcstDate\":\"20250101\",\"fcstTime\":\"0000\",\"fcstValue\":\"-2.0\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"PCP\",\"fcstDate\":\"20250101\",\"fcstTime\":\"0000\",\"fcstValue\":\"30.0~50.0mm\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"WSD\",\"fcstDate\":\"20250101\",\"fcstTime\":\"0000\",\"fcstValue\":\"3.0\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"VEC\",\"fcstDate\":\"20250101\",\"fcstTime\":\"0000\",\"fcstValue\":\"320\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"SKY\",\"fcstDate\":\"20250101\",\"fcstTime\":\"0000\",\"fcstValue\":\"4\",\"nx\":60,\"ny\":127},"
+  "{\"baseDate\":\"20241231\",\"baseTime\":\"2000\",\"category\":\"TMP\",\"fcstDate\":\"20250101\",\"fcstTime\":\"0100\",\"fcstValue\":\"-2.2\",\"nx\":60,\"ny\":127}"
+  "]},\"pageNo\":1,\"numOfRows\":200,\"totalCount\":19}}}";
+
+static GridPoint rowGrid[locationCount];
+static char rowName[locationCount][LOCATION_NAME_BUF];
+
+static double rowLat(int i) { return locationList[i].lat * LOCATION_COORD_UNIT; }
+static double rowLon(int i) { return locationList[i].lon * LOCATION_COORD_UNIT; }
+
+void setUp() {}
+void tearDown() {}
+
+static void bench_changeToXY() {
+  bench::run("changeToXY", 200000, [](long i) {
+    int r = i % locationCount;
+    GridPoint p = changeToXY(rowLat(r), rowLon(r));
+    bench::keep(p);
+  });
+
+  // 결과가 표의 격자값과 대체로 일치하는지 (표 자체 오차 몇 건은 허용)
+  int mismatch = 0;
+  for (int i = 0; i < locationCount; i++) {
+    GridPoint p = changeToXY(rowLat(i), rowLon(i));
+    if (p.x != locationList[i].gridX || p.y != locationList[i].gridY) mismatch++;
+  }
+  TEST_ASSERT_LESS_THAN(locationCount / 50, mismatch);
+}
+
+static void bench_changeToXYFloat() {
+  bench::run("changeToXYFloat", 200000, [](long i) {
+    int r = i % locationCount;
+    GridPoint p = changeToXYFloat((float)rowLat(r), (float)rowLon(r));
+    bench::keep(p);
+  });
+
+  // 펌웨어(GRID_PROJECTION_FLOAT)에서 쓰는 float 변환은 표의 모든 행에서 double과 같은 격자여야 한다.
+  for (int i = 0; i < locationCount; i++) {
+    GridPoint d = changeToXY(rowLat(i), rowLon(i));
+    GridPoint f = changeToXYFloat((float)rowLat(i), (float)rowLon(i));
+    TEST_ASSERT_EQUAL(d.x, f.x);
+    TEST_ASSERT_EQUAL(d.y, f.y);
+  }
+}
+
+static void bench_changeToXYBatch() {
+  static double lat[locationCount], lon[locationCount];
+  static GridPoint out[locationCount];
+  for (int i = 0; i < locationCount; i++) {
+    lat[i] = rowLat(i);
+    lon[i] = rowLon(i);
+  }
+  bench::run("changeToXYBatch (per point)", 50, [](long) {
+    changeToXYBatch(lat, lon, out, locationCount);
+    bench::keep(out[0]);
+  }, locationCount);
+
+  // 한 점씩 변환한 것과 같아야 한다.
+  for (int i = 0; i < locationCount; i++) {
+    GridPoint p = changeToXY(lat[i], lon[i]);
+    TEST_ASSERT_EQUAL(p.x, out[i].x);
+    TEST_ASSERT_EQUAL(p.y, out[i].y);
+  }
+}
+
+static void bench_changeToLatLon() {
+  bench::run("changeToLatLon", 200000, [](long i) {
+    double lat, lon;
+    changeToLatLon(21 + i % 124, 1 + i % 253, &lat, &lon);
+    bench::keep(lat + lon);
+  });
+
+  // 기준점은 (OLAT, OLON), 모든 격자 중심은 다시 자기 격자로 돌아와야 한다.
+  double lat, lon;
+  changeToLatLon(XO, YO, &lat, &lon);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-9, OLAT, lat);
+  TEST_ASSERT_DOUBLE_WITHIN(1e-9, OLON, lon);
+  for (int x = 1; x <= 149; x++) {
+    for (int y = 1; y <= 253; y++) {
+      changeToLatLon(x, y, &lat, &lon);
+      GridPoint p = changeToXY(lat, lon);
+      TEST_ASSERT_EQUAL(x, p.x);
+      TEST_ASSERT_EQUAL(y, p.y);
+    }
+  }
+}
+
+static void bench_findNearestRegion() {
+  for (int i = 0; i < locationCount; i++) {
+    rowGrid[i] = changeToXY(rowLat(i), rowLon(i));
+  }
+  bench::run("findNearestRegion", 20000, [](long i) {
+    int r = i % locationCount;
+    int row = findNearestRegion(rowGrid[r].x, rowGrid[r].y, rowLat(r), rowLon(r));
+    bench::keep(row);
+  });
+
+  // 표에 있는 지점 그대로 넣으면 같은 좌표의 지역이 나와야 한다.
+  TEST_ASSERT_EQUAL(0, findNearestRegion(60, 127, 37.563569, 126.980008));
+  TEST_ASSERT_EQUAL(-1, findNearestRegion(1, 1, 37.563569, 126.980008));
+}
+
+static void bench_locateRegion() {
+  // 서울 시내를 1초에 약 20m씩 움직이는 GPS 경로 (가끔 방향을 바꾼다)
+  static double lat[4096], lon[4096];
+  uint32_t seed = 12345;
+  double la = 37.3, lo = 127.0, dLat = 0.0002, dLon = 0.0002;
+  for (int i = 0; i < 4096; i++) {
+    seed = seed * 1664525u + 1013904223u;
+    if ((seed >> 28) == 0) {
+      dLat = ((int)((seed >> 8) & 255) - 128) * 2e-6;
+      dLon = ((int)((seed >> 16) & 255) - 128) * 2e-6;
+    }
+    lat[i] = la += dLat;
+    lon[i] = lo += dLon;
+  }
+
+  bench::run("changeToXY + findNearestRegion", 20000, [](long i) {
+    GridPoint p = changeToXY(lat[i % 4096], lon[i % 4096]);
+    bench::keep(findNearestRegion(p.x, p.y, lat[i % 4096], lon[i % 4096]));
+  });
+  bench::run("locateRegion", 20000, [](long i) {
+    GridPoint p;
+    bench::keep(locateRegion(lat[i % 4096], lon[i % 4096], &p));
+  });
+
+  // 래스터를 쓰든 안 쓰든 정확 계산과 같은 격자, 같은 지역이어야 한다.
+  // (경로 + 표의 모든 지점 + 한반도 범위의 의사 난수 지점)
+  for (int i = 0; i < 4096 + locationCount + 100000; i++) {
+    if (i < 4096) {
+      la = lat[i];
+      lo = lon[i];
+    } else if (i < 4096 + locationCount) {
+      la = rowLat(i - 4096);
+      lo = rowLon(i - 4096);
+    } else {
+      seed = seed * 1664525u + 1013904223u;
+      la = 33.0 + (seed >> 8) * (5.8 / 16777216.0);
+      seed = seed * 1664525u + 1013904223u;
+      lo = 124.5 + (seed >> 8) * (7.6 / 16777216.0);
+    }
+    GridPoint exact = changeToXY(la, lo);
+    GridPoint p;
+    TEST_ASSERT_EQUAL(findNearestRegion(exact.x, exact.y, la, lo), locateRegion(la, lo, &p));
+    TEST_ASSERT_EQUAL(exact.x, p.x);
+    TEST_ASSERT_EQUAL(exact.y, p.y);
+  }
+}
+
+// 표 전체를 순서대로 보는 기준 구현 (가까운 순 k개, 같은 거리는 앞 행 먼저)
+static int nearestByFullScan(double lat, double lon, int k, int* out) {
+  static double dist[locationCount];
+  static int order[locationCount];
+  double lonScale = lonScaleAt(lat);
+  for (int i = 0; i < locationCount; i++) {
+    dist[i] = getDistanceSquared(rowLat(i), rowLon(i), lat, lon, lonScale);
+    order[i] = i;
+  }
+  std::stable_sort(order, order + locationCount, [](int a, int b) { return dist[a] < dist[b]; });
+  for (int j = 0; j < k; j++) out[j] = order[j];
+  return k;
+}
+
+static int nearestByFullScan(double lat, double lon) {
+  int best;
+  nearestByFullScan(lat, lon, 1, &best);
+  return best;
+}
+
+static void bench_findNearestRegionScan() {
+  bench::run("findNearestRegionScan", 2000, [](long i) {
+    int r = (i * 7) % locationCount;
+    int row = findNearestRegionScan(rowLat(r) + 0.003, rowLon(r) - 0.002);
+    bench::keep(row);
+  });
+
+  for (int i = 0; i < locationCount; i += 13) {
+    double lat = rowLat(i) + 0.003;
+    double lon = rowLon(i) - 0.002;
+    TEST_ASSERT_EQUAL(nearestByFullScan(lat, lon), findNearestRegionScan(lat, lon));
+  }
+}
+
+static void bench_findNearestRegions() {
+  bench::run("findNearestRegions k=5", 20000, [](long i) {
+    int r = (i * 7) % locationCount;
+    RegionMatch m[5];
+    int n = findNearestRegions(rowLat(r) + 0.003, rowLon(r) - 0.002, 5, m);
+    bench::keep(n);
+  });
+
+  // 격자 링 탐색 결과가 표 전체를 거리순으로 정렬한 것과 같아야 한다.
+  for (int i = 0; i < locationCount; i += 29) {
+    if (locationList[i].lat == 0) continue;  // 좌표 없는 행 (Ieodo)
+    double lat = rowLat(i) + 0.003;
+    double lon = rowLon(i) - 0.002;
+    RegionMatch m[5];
+    int expected[5];
+    int n = findNearestRegions(lat, lon, 5, m);  // 외딴 섬은 탐색 반경 안에 5곳이 안 될 수 있다
+    TEST_ASSERT_GREATER_THAN(0, n);
+    nearestByFullScan(lat, lon, 5, expected);
+    for (int j = 0; j < n; j++) TEST_ASSERT_EQUAL(expected[j], m[j].row);
+  }
+
+  // 서울시청 앞: 가장 가까운 곳은 거리 0
+  RegionMatch m[3];
+  TEST_ASSERT_EQUAL(3, findNearestRegions(37.563569, 126.980008, 3, m));
+  TEST_ASSERT_EQUAL(0, m[0].row);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.0f, m[0].distanceKm);
+  TEST_ASSERT_TRUE(m[1].distanceKm <= m[2].distanceKm);
+
+  // 경도 0.01도 차이는 위도 37.5도에서 약 0.88km
+  double lonScale = lonScaleAt(37.5);
+  float km = sqrt(getDistanceSquared(37.5, 127.0, 37.5, 127.01, lonScale)) * DEGRAD * RE;
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.88f, km);
+
+  // 바다 한가운데 (동해 먼바다): 반경 안에 아무것도 없음
+  TEST_ASSERT_EQUAL(0, findNearestRegions(38.5, 133.5, 3, m));
+}
+
+static void bench_getLocationName() {
+  bench::run("getLocationName", 200000, [](long i) {
+    char name[LOCATION_NAME_BUF];
+    size_t n = getLocationName((i * 7) % locationCount, name, sizeof(name));
+    bench::keep(n);
+  });
+
+  char name[LOCATION_NAME_BUF];
+  TEST_ASSERT_EQUAL(26, getLocationName(3, name, sizeof(name)));
+  TEST_ASSERT_EQUAL_STRING("Seoul Jongro-Gu Sajik-Dong", name);
+  TEST_ASSERT_EQUAL(26, getLocationName(3, name, 6));
+  TEST_ASSERT_EQUAL_STRING("Seoul", name);
+
+  for (int i = 0; i < locationCount; i++) {
+    getLocationName(i, rowName[i], sizeof(rowName[i]));
+  }
+}
+
+static void bench_findXYByLocation() {
+  bench::run("findXYByLocation", 20000, [](long i) {
+    int x, y;
+    bool ok = findXYByLocation(rowName[(i * 7) % locationCount], &x, &y);
+    bench::keep(ok);
+  });
+
+  // 표의 모든 이름이 자기 격자로 찾아져야 한다.
+  for (int i = 0; i < locationCount; i++) {
+    int x = 0, y = 0;
+    TEST_ASSERT_TRUE(findXYByLocation(rowName[i], &x, &y));
+    TEST_ASSERT_EQUAL(locationList[i].gridX, x);
+    TEST_ASSERT_EQUAL(locationList[i].gridY, y);
+  }
+
+  int x = 0, y = 0;
+  TEST_ASSERT_TRUE(findXYByLocation("Seoul Jongro-Gu Sajik-Dong", &x, &y));
+  TEST_ASSERT_EQUAL(60, x);
+  TEST_ASSERT_EQUAL(127, y);
+  TEST_ASSERT_FALSE(findXYByLocation("Nowhere", &x, &y));
+  TEST_ASSERT_FALSE(findXYByLocation("Seoul Jongro-Gu Sajik", &x, &y));
+  TEST_ASSERT_FALSE(findXYByLocation("Seoul Jongro-Gu Sajik-Dong ", &x, &y));
+}
+
+static void bench_suggestLocations() {
+  static const char* queries[] = { "gangbuk samyang", "sajik", "haeundae", "jeju samyang" };
+  bench::run("suggestLocations prefix", 20000, [](long i) {
+    int rows[REGION_SUGGEST_MAX];
+    bench::keep(suggestLocations(queries[i % 4], rows, REGION_SUGGEST_MAX));
+  });
+  bench::run("suggestLocations typo", 500, [](long) {
+    int rows[REGION_SUGGEST_MAX];
+    bench::keep(suggestLocations("samyng", rows, REGION_SUGGEST_MAX));
+  });
+
+  int rows[REGION_SUGGEST_MAX];
+  TEST_ASSERT_EQUAL(1, suggestLocations("Gangbuk Samyang", rows, REGION_SUGGEST_MAX));
+  TEST_ASSERT_EQUAL_STRING("Seoul Gangbuk-Gu Samyang-Dong", rowName[rows[0]]);
+  TEST_ASSERT_EQUAL(1, suggestLocations("jongro  SAJIK", rows, REGION_SUGGEST_MAX));
+  TEST_ASSERT_EQUAL_STRING("Seoul Jongro-Gu Sajik-Dong", rowName[rows[0]]);
+
+  // 단어 앞부분: 접미사를 붙이지 않은 것이 먼저, 최대 n개
+  int n = suggestLocations("sajik", rows, 3);
+  TEST_ASSERT_EQUAL(3, n);
+  TEST_ASSERT_EQUAL_STRING("Seoul Jongro-Gu Sajik-Dong", rowName[rows[0]]);
+  TEST_ASSERT_EQUAL_STRING("Gwangju Nam-Gu Sajik-Dong", rowName[rows[1]]);
+
+  // 한 글자 오타
+  TEST_ASSERT_EQUAL(1, suggestLocations("Gangbk Samyang", rows, REGION_SUGGEST_MAX));
+  TEST_ASSERT_EQUAL_STRING("Seoul Gangbuk-Gu Samyang-Dong", rowName[rows[0]]);
+
+  TEST_ASSERT_EQUAL(0, suggestLocations("xyzzy", rows, REGION_SUGGEST_MAX));
+  TEST_ASSERT_EQUAL(0, suggestLocations("   ", rows, REGION_SUGGEST_MAX));
+
+  // 표의 모든 이름은 전체 이름으로 검색하면 첫 후보가 자기 이름이어야 한다.
+  for (int i = 0; i < locationCount; i += 13) {
+    TEST_ASSERT_TRUE(suggestLocations(rowName[i], rows, REGION_SUGGEST_MAX) > 0);
+    TEST_ASSERT_EQUAL_STRING(rowName[i], rowName[rows[0]]);
+  }
+}
+
+static void bench_findLocationNameByXY() {
+  bench::run("findLocationNameByXY", 20000, [](long i) {
+    const LocationData& row = locationList[(i * 7) % locationCount];
+    String name;
+    bool ok = findLocationNameByXY(row.gridX, row.gridY, name);
+    bench::keep(ok);
+  });
+
+  String name;
+  TEST_ASSERT_TRUE(findLocationNameByXY(60, 127, name));
+  TEST_ASSERT_EQUAL_STRING("Seoul", name.c_str());
+  TEST_ASSERT_FALSE(findLocationNameByXY(1, 1, name));
+
+  // 격자 칸의 후보 목록에는 그 칸의 모든 행이 들어 있어야 한다.
+  for (int i = 0; i < locationCount; i++) {
+    const uint16_t* rows;
+    int n = findLocationRowsByXY(locationList[i].gridX, locationList[i].gridY, &rows);
+    bool found = false;
+    for (int k = 0; k < n; k++) {
+      if (pgm_read_word(&rows[k]) == i) found = true;
+    }
+    TEST_ASSERT_TRUE(found);
+  }
+}
+
+static void bench_extractWeather() {
+  String json(ncstSampleJson);
+  bench::run("extractWeather", 50000, [&json](long) {
+    float T, H, RN, W, VEC;
+    bool ok = extractWeather(json, T, H, RN, W, VEC);
+    bench::keep(ok);
+  });
+
+  float T, H, RN, W, VEC;
+  TEST_ASSERT_TRUE(extractWeather(json, T, H, RN, W, VEC));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -3.2f, T);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 71.0f, H);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, RN);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.1f, W);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 265.0f, VEC);
+}
+
+// 연결에서 조각조각 들어오는 경우 (writeToStream이 나눠 넘기는 것과 같음)
+static void bench_ncstParserStream() {
+  const uint8_t* bytes = (const uint8_t*)ncstSampleJson;
+  size_t size = strlen(ncstSampleJson);
+
+  bench::run("NcstParser (64B chunks)", 50000, [bytes, size](long) {
+    NcstParser parser;
+    for (size_t off = 0; off < size; off += 64) parser.write(bytes + off, std::min<size_t>(64, size - off));
+    WeatherObs obs;
+    bench::keep(parser.finish(obs));
+  });
+
+  for (size_t chunk = 1; chunk <= 17; chunk++) {
+    NcstParser parser;
+    for (size_t off = 0; off < size; off += chunk) parser.write(bytes + off, std::min(chunk, size - off));
+    WeatherObs obs;
+    TEST_ASSERT_TRUE(parser.finish(obs));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, -3.2f, obs.T1H);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 71.0f, obs.REH);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 265.0f, obs.VEC);
+  }
+
+  // 도중에 끊긴 응답은 실패
+  NcstParser cut;
+  cut.write(bytes, size - 5);
+  WeatherObs obs;
+  TEST_ASSERT_FALSE(cut.finish(obs));
+
+  // 공백, 이스케이프, 숫자 값, 관심 없는 중첩 객체
+  const char* loose =
+    "{ \"response\" : { \"header\" : { \"resultMsg\" : \"a\\\"}]b\" },\n"
+    "  \"body\" : { \"items\" : { \"item\" : [\n"
+    "    { \"category\" : \"T1H\", \"obsrValue\" : 12.5, \"extra\" : { \"category\" : \"X\" } },\n"
+    "    { \"obsrValue\" : -1, \"category\" : \"REH\" }\n"
+    "  ] }, \"totalCount\" : 2 } } }\n";
+  NcstParser p;
+  p.write((const uint8_t*)loose, strlen(loose));
+  TEST_ASSERT_TRUE(p.finish(obs));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 12.5f, obs.T1H);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.0f, obs.REH);
+
+  // 문법 오류
+  const char* bad = "{\"response\":{\"item\":[{\"category\":\"T1H\" \"obsrValue\":\"1\"}]}}";
+  NcstParser q;
+  q.write((const uint8_t*)bad, strlen(bad));
+  TEST_ASSERT_FALSE(q.finish(obs));
+}
+
+static void bench_extractForecastSeries() {
+  String json(vilageSampleJson);
+  bench::run("extractForecastSeries (3h)", 20000, [&json](long) {
+    WeatherObs out[3];
+    bench::keep(extractForecastSeries(json, 20241231, 2200, 3, out));
+  });
+
+  // 22시부터 3시간: 21시와 01시는 범위 밖, 자정을 넘어도 칸이 맞아야 한다.
+  WeatherObs out[3];
+  TEST_ASSERT_EQUAL_INT(2, extractForecastSeries(json, 20241231, 2200, 3, out));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.0f, out[0].T1H);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 65.0f, out[0].REH);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, out[0].RN1);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 2.1f, out[0].WSD);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 300.0f, out[0].VEC);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.5f, out[1].T1H);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.5f, out[1].RN1);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -2.0f, out[2].T1H);
+  TEST_ASSERT_TRUE(isnan(out[2].REH));
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 40.0f, out[2].RN1);
+
+  // 조각으로 넣어도 같다.
+  ForecastParser parser(20241231, 2200, 3, out);
+  for (unsigned off = 0; off < json.length(); off += 7) {
+    parser.write((const uint8_t*)json.c_str() + off, std::min(7u, json.length() - off));
+  }
+  TEST_ASSERT_EQUAL_INT(2, parser.finish());
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, -1.5f, out[1].T1H);
+
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, parsePrecipitation("강수없음"));
+  TEST_ASSERT_EQUAL_FLOAT(0.5f, parsePrecipitation("1mm 미만"));
+  TEST_ASSERT_EQUAL_FLOAT(6.0f, parsePrecipitation("6.0mm"));
+  TEST_ASSERT_EQUAL_FLOAT(50.0f, parsePrecipitation("50.0mm 이상"));
+  TEST_ASSERT_TRUE(isnan(parsePrecipitation("")));
+
+  TEST_ASSERT_EQUAL_INT(1, kmaHourIndex(20250101, 0) - kmaHourIndex(20241231, 2300));
+  TEST_ASSERT_EQUAL_INT(24, kmaHourIndex(20240301, 0) - kmaHourIndex(20240229, 0));
+}
+
+static void bench_packObs() {
+  WeatherObs obs = { -3.2f, 71, 2.5f, 1.1f, 265 };
+  bench::run("packObs", 200000, [&obs](long i) {
+    obs.T1H = (float)(i & 63) * 0.1f;
+    bench::keep(packObs(obs).t10);
+  });
+  PackedObs packed = packObs(obs);
+  bench::run("unpackObs", 200000, [&packed](long i) {
+    packed.t10 = (int16_t)(i & 63);
+    bench::keep(unpackObs(packed).T1H);
+  });
+
+  TEST_ASSERT_EQUAL_INT(8, (int)sizeof(PackedObs));
+
+  // 0.1 단위 값은 그대로 돌아온다.
+  obs = { -3.2f, 71, 2.5f, 1.1f, 264 };
+  WeatherObs o = unpackObs(packObs(obs));
+  TEST_ASSERT_EQUAL_FLOAT(-3.2f, o.T1H);
+  TEST_ASSERT_EQUAL_FLOAT(71.0f, o.REH);
+  TEST_ASSERT_EQUAL_FLOAT(2.5f, o.RN1);
+  TEST_ASSERT_EQUAL_FLOAT(1.1f, o.WSD);
+  TEST_ASSERT_EQUAL_FLOAT(264.0f, o.VEC);
+
+  // 반올림: 기온 0.1 °C, 습도 1 %, 풍향 2°
+  obs = { 12.34f, 55.6f, 0.04f, 3.05f, 359 };
+  o = unpackObs(packObs(obs));
+  TEST_ASSERT_FLOAT_WITHIN(0.051f, 12.34f, o.T1H);
+  TEST_ASSERT_EQUAL_FLOAT(56.0f, o.REH);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, o.RN1);
+  TEST_ASSERT_FLOAT_WITHIN(0.051f, 3.05f, o.WSD);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, o.VEC);   // 359 -> 360 -> 0
+  obs.VEC = 357;
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, 357.0f, unpackObs(packObs(obs)).VEC);
+
+  // 범위 밖은 끝값으로 자른다.
+  obs = { 45.0f, 130, 80.0f, 40.0f, 90 };
+  o = unpackObs(packObs(obs));
+  TEST_ASSERT_EQUAL_FLOAT(45.0f, o.T1H);
+  TEST_ASSERT_EQUAL_FLOAT(100.0f, o.REH);
+  TEST_ASSERT_EQUAL_FLOAT(80.0f, o.RN1);
+  TEST_ASSERT_EQUAL_FLOAT(25.4f, o.WSD);
+  obs = { 0, -5, -1.0f, -2.0f, 0 };
+  o = unpackObs(packObs(obs));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, o.REH);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, o.RN1);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, o.WSD);
+
+  // 없는 값(NAN)은 NAN으로 돌아온다.
+  obs = { NAN, NAN, NAN, NAN, NAN };
+  o = unpackObs(packObs(obs));
+  TEST_ASSERT_TRUE(isnan(o.T1H) && isnan(o.REH) && isnan(o.RN1) && isnan(o.WSD) && isnan(o.VEC));
+}
+
+// 메모리 버퍼를 Stream으로 읽기 (로그 파일 대신)
+class BufferStream : public Stream {
+public:
+  BufferStream(const uint8_t* data, size_t size) : data_(data), size_(size), pos_(0), reads_(0) {}
+  int available() override { return (int)(size_ - pos_); }
+  int read() override { reads_++; return pos_ < size_ ? data_[pos_++] : -1; }
+  int peek() override { return pos_ < size_ ? data_[pos_] : -1; }
+  size_t write(uint8_t) override { return 0; }
+  void rewind() { pos_ = 0; reads_ = 0; }
+  // File::seek(n, SeekCur)처럼 읽지 않고 위치만 옮긴다.
+  void seek(size_t n) { pos_ += n; }
+  size_t reads() const { return reads_; }
+
+private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t pos_;
+  size_t reads_;
+};
+
+// 다른 격자 블록을 seek로 건너뛰는 읽기 (history_log.cpp의 FileLogReader와 같은 방식)
+class SeekingLogReader : public HistoryLogReader {
+public:
+  SeekingLogReader(BufferStream& in, uint8_t nx, uint8_t ny) : HistoryLogReader(in, nx, ny), in_(in) {}
+
+protected:
+  bool skip(uint16_t n) override { in_.seek(n); return true; }
+
+private:
+  BufferStream& in_;
+};
+
+static bool samePacked(const PackedObs& a, const PackedObs& b) {
+  return a.t10 == b.t10 && a.rn10 == b.rn10 && a.reh == b.reh && a.wsd10 == b.wsd10 && a.vec2 == b.vec2;
+}
+
+static void bench_historyLog() {
+  // 하루치 매시간 샘플, 천천히 변하는 값
+  int32_t hours[24];
+  PackedObs samples[24];
+  int32_t base = (int32_t)kmaHourIndex(20250101, 0);
+  for (int i = 0; i < 24; i++) {
+    hours[i] = base + i;
+    WeatherObs o = { -3.2f + 0.3f * (i % 8), (float)(70 - i / 2), i >= 20 ? 0.5f : 0.0f,
+                     1.1f + 0.1f * (i % 3), 260.0f + 2 * (i / 6) };
+    samples[i] = packObs(o);
+  }
+
+  static uint8_t log[4 * HISTORY_LOG_BLOCK_MAX];
+  size_t n = 0;
+  bench::run("historyLogEncode (24 h)", 20000, [&](long) {
+    n = historyLogEncode(60, 127, hours, samples, 24, log, sizeof(log));
+  }, 24);
+  TEST_ASSERT_TRUE(n > 0);
+  TEST_ASSERT_TRUE(n < 24 * sizeof(PackedObs) / 2);  // 그대로 쓰는 것의 절반도 안 됨
+
+  size_t first = n;
+
+  // 같은 로그에 다른 격자 블록, 그 뒤에 빈 시간이 있고 순서가 섞인 블록
+  n += historyLogEncode(61, 127, hours, samples, 6, log + n, sizeof(log) - n);
+  int32_t gapHours[3] = { base + 30, base + 24, base + 40 };
+  PackedObs gapSamples[3] = { samples[0], samples[23], packObs({ NAN, NAN, NAN, NAN, NAN }) };
+  size_t before = n;
+  n += historyLogEncode(60, 127, gapHours, gapSamples, 3, log + n, sizeof(log) - n);
+  TEST_ASSERT_TRUE(n > before);
+
+  BufferStream in(log, n);
+  bench::run("HistoryLogReader (24 h + skip)", 20000, [&in](long) {
+    in.rewind();
+    HistoryLogReader reader(in, 60, 127);
+    int32_t hour;
+    PackedObs s;
+    int count = 0;
+    while (reader.next(hour, s)) count++;
+    bench::keep(count);
+  }, 24);
+
+  in.rewind();
+  HistoryLogReader reader(in, 60, 127);
+  int32_t hour;
+  PackedObs s;
+  for (int i = 0; i < 24; i++) {
+    TEST_ASSERT_TRUE(reader.next(hour, s));
+    TEST_ASSERT_EQUAL_INT(hours[i], hour);
+    TEST_ASSERT_TRUE(samePacked(samples[i], s));
+  }
+  for (int i = 0; i < 3; i++) {
+    TEST_ASSERT_TRUE(reader.next(hour, s));
+    TEST_ASSERT_EQUAL_INT(gapHours[i], hour);
+    TEST_ASSERT_TRUE(samePacked(gapSamples[i], s));
+  }
+  TEST_ASSERT_FALSE(reader.next(hour, s));
+  TEST_ASSERT_TRUE(isnan(unpackObs(s).T1H));
+
+  // 다른 격자만 읽기
+  in.rewind();
+  HistoryLogReader other(in, 61, 127);
+  int count = 0;
+  while (other.next(hour, s)) count++;
+  TEST_ASSERT_EQUAL_INT(6, count);
+
+  // 쓰다가 끊긴 로그: 끊기기 전 샘플까지만 나오고 멈춘다.
+  BufferStream torn(log, first - 3);
+  HistoryLogReader partial(torn, 60, 127);
+  count = 0;
+  while (partial.next(hour, s)) {
+    TEST_ASSERT_EQUAL_INT(hours[count], hour);
+    count++;
+  }
+  TEST_ASSERT_TRUE(count > 0 && count < 24);
+
+  // 예보로 채운 시간은 관측이 아니므로 로그에 모으지 않는다.
+  historyLogClear();
+  TEST_ASSERT_TRUE(historyLogStage(60, 127, base + 1, samples[1], false));
+  TEST_ASSERT_FALSE(historyLogStage(60, 127, base, samples[0], true));
+  TEST_ASSERT_TRUE(historyLogStage(60, 127, base + 2, samples[2], false));
+  TEST_ASSERT_EQUAL_INT(2, historyLogPending());
+  TEST_ASSERT_TRUE(historyLogFlush());
+  TEST_ASSERT_EQUAL_INT(0, historyLogPending());
+
+  // 블록 크기를 넘거나 자리가 모자라면 만들지 않는다.
+  TEST_ASSERT_EQUAL_INT(0, (int)historyLogEncode(60, 127, hours, samples, 0, log, sizeof(log)));
+  TEST_ASSERT_EQUAL_INT(0, (int)historyLogEncode(60, 127, hours, samples, 24, log, 16));
+}
+
+// 여러 격자가 섞인 로그에서 한 격자의 창만 읽기
+static void bench_historyLogMixed() {
+  const int cells = 10, rounds = 20;
+  static uint8_t log[cells * rounds * 128];
+  size_t n = 0;
+  int32_t base = (int32_t)kmaHourIndex(20250101, 0);
+  for (int r = 0; r < rounds; r++) {
+    for (int c = 0; c < cells; c++) {
+      int32_t hours[24];
+      PackedObs samples[24];
+      for (int i = 0; i < 24; i++) {
+        hours[i] = base + r * 24 + i;
+        WeatherObs o = { (float)c + 0.1f * i, (float)(50 + r), 0, 1.0f, 180 };
+        samples[i] = packObs(o);
+      }
+      size_t b = historyLogEncode(60 + c, 127, hours, samples, 24, log + n, sizeof(log) - n);
+      TEST_ASSERT_TRUE(b > 0);
+      n += b;
+    }
+  }
+
+  BufferStream in(log, n);
+  bench::run("HistoryLogReader mixed (read)", 2000, [&in](long) {
+    in.rewind();
+    HistoryLogReader reader(in, 63, 127);
+    int32_t hour; PackedObs s; int count = 0;
+    while (reader.next(hour, s)) count++;
+    bench::keep(count);
+  }, rounds * 24);
+  size_t readAll = in.reads();
+  bench::run("HistoryLogReader mixed (seek)", 2000, [&in](long) {
+    in.rewind();
+    SeekingLogReader reader(in, 63, 127);
+    int32_t hour; PackedObs s; int count = 0;
+    while (reader.next(hour, s)) count++;
+    bench::keep(count);
+  }, rounds * 24);
+  TEST_ASSERT_TRUE(readAll >= n);
+  TEST_ASSERT_TRUE(in.reads() * 5 < n);  // 다른 격자 본문은 읽지 않음
+
+  // 마지막 이틀 창: 격자 3의 값만, 시간 순서대로
+  in.rewind();
+  SeekingLogReader reader(in, 63, 127);
+  int32_t from = base + (rounds - 2) * 24, to = base + rounds * 24 - 1;
+  int32_t hour, expect = from;
+  PackedObs s;
+  while (reader.next(hour, s)) {
+    if (hour < from || hour > to) continue;
+    TEST_ASSERT_EQUAL_INT(expect, hour);
+    WeatherObs o = unpackObs(s);
+    int i = (hour - base) % 24, r = (hour - base) / 24;
+    TEST_ASSERT_FLOAT_WITHIN(0.051f, 3.0f + 0.1f * i, o.T1H);
+    TEST_ASSERT_EQUAL_FLOAT((float)(50 + r), o.REH);
+    expect++;
+  }
+  TEST_ASSERT_EQUAL_INT(to + 1, expect);
+}
+
+static void bench_frameDiff() {
+  static uint8_t shown[128 * 8];
+  static uint8_t now[128 * 8];
+  FrameSpan spans[8];
+
+  memset(shown, 0, sizeof(shown));
+  memcpy(now, shown, sizeof(now));
+  bench::run("frameDiff (no change)", 200000, [&spans](long) {
+    bench::keep(frameDiff(now, shown, 128, 8, spans));
+  });
+  TEST_ASSERT_EQUAL_INT(0, frameDiff(now, shown, 128, 8, spans));
+
+  // 한 점(3x3)이 페이지 경계에 걸치면 두 페이지, 같은 열 범위
+  now[2 * 128 + 40] = 0xC0; now[2 * 128 + 41] = 0xC0; now[2 * 128 + 42] = 0xC0;
+  now[3 * 128 + 40] = 0x01; now[3 * 128 + 41] = 0x01; now[3 * 128 + 42] = 0x01;
+  // 마지막 페이지의 양 끝
+  now[7 * 128 + 0] = 0xFF;
+  now[7 * 128 + 127] = 0xFF;
+  bench::run("frameDiff (3 pages)", 200000, [&spans](long) {
+    bench::keep(frameDiff(now, shown, 128, 8, spans));
+  });
+
+  TEST_ASSERT_EQUAL_INT(3, frameDiff(now, shown, 128, 8, spans));
+  TEST_ASSERT_EQUAL_INT(2, spans[0].page);
+  TEST_ASSERT_EQUAL_INT(40, spans[0].first);
+  TEST_ASSERT_EQUAL_INT(42, spans[0].last);
+  TEST_ASSERT_EQUAL_INT(3, spans[1].page);
+  TEST_ASSERT_EQUAL_INT(40, spans[1].first);
+  TEST_ASSERT_EQUAL_INT(42, spans[1].last);
+  TEST_ASSERT_EQUAL_INT(7, spans[2].page);
+  TEST_ASSERT_EQUAL_INT(0, spans[2].first);
+  TEST_ASSERT_EQUAL_INT(127, spans[2].last);
+}
+
+static void bench_obsCache() {
+  obsCacheClear();
+  WeatherObs obs = { -3.2f, 71, 0, 1.1f, 265 };
+  for (int h = 0; h < 12; h++) obsCachePut(60, 127, 20250101, h * 100, obs);
+
+  bench::run("obsCacheGet (12h hit)", 20000, [](long i) {
+    WeatherObs o;
+    bench::keep(obsCacheGet(60, 127, 20250101, (i % 12) * 100, o));
+  });
+
+  // 키 네 개가 모두 맞아야 찾는다.
+  obsCacheClear();
+  for (int h = 0; h < 12; h++) obsCachePut(60, 127, 20250101, h * 100, obs);
+  WeatherObs o = {};
+  TEST_ASSERT_TRUE(obsCacheGet(60, 127, 20250101, 600, o));
+  TEST_ASSERT_EQUAL_FLOAT(-3.2f, o.T1H);
+  TEST_ASSERT_EQUAL_FLOAT(265, o.VEC);
+  TEST_ASSERT_FALSE(obsCacheGet(61, 127, 20250101, 600, o));
+  TEST_ASSERT_FALSE(obsCacheGet(60, 126, 20250101, 600, o));
+  TEST_ASSERT_FALSE(obsCacheGet(60, 127, 20250102, 600, o));
+  TEST_ASSERT_FALSE(obsCacheGet(60, 127, 20250101, 1200, o));
+
+  // 같은 키는 덮어쓴다.
+  obs.T1H = 5.0f;
+  obsCachePut(60, 127, 20250101, 600, obs);
+  TEST_ASSERT_TRUE(obsCacheGet(60, 127, 20250101, 600, o));
+  TEST_ASSERT_EQUAL_FLOAT(5.0f, o.T1H);
+
+  // 가득 차면 가장 오래 안 쓴 항목부터 버린다. (0시는 방금 읽었으므로 남는다)
+  TEST_ASSERT_TRUE(obsCacheGet(60, 127, 20250101, 0, o));
+  for (int k = 0; k < OBS_CACHE_SIZE - 12 + 1; k++) obsCachePut(98, 76, 20250102, k, obs);
+  TEST_ASSERT_TRUE(obsCacheGet(60, 127, 20250101, 0, o));
+  TEST_ASSERT_FALSE(obsCacheGet(60, 127, 20250101, 100, o));
+  TEST_ASSERT_TRUE(obsCacheGet(60, 127, 20250101, 200, o));
+  TEST_ASSERT_TRUE(obsCacheGet(98, 76, 20250102, 0, o));
+
+  obsCacheClear();
+  TEST_ASSERT_FALSE(obsCacheGet(60, 127, 20250101, 0, o));
+}
+
+static void bench_fetchSched() {
+  fetchSchedClear();
+  uint32_t g;
+  bench::run("fetchSchedRequest (coalesced)", 200000, [&g](long i) {
+    if (i == 0) fetchSchedRequest(60, 127, false, 0, &g);
+    bench::keep(fetchSchedRequest(60, 127, true, (uint32_t)i, &g));
+  });
+
+  // 받는 중인 같은 격자는 합친다.
+  fetchSchedClear();
+  uint32_t a, b, c;
+  TEST_ASSERT_EQUAL_INT(FETCH_START, fetchSchedRequest(60, 127, false, 1000, &a));
+  TEST_ASSERT_TRUE(fetchSchedBusy());
+  TEST_ASSERT_EQUAL_INT(FETCH_COALESCED, fetchSchedRequest(60, 127, true, 1100, &b));
+  TEST_ASSERT_EQUAL_UINT32(a, b);
+
+  // 다른 격자가 오면 앞 세대는 취소, 앞 세대의 끝 알림은 무시
+  TEST_ASSERT_EQUAL_INT(FETCH_START, fetchSchedRequest(98, 76, false, 1200, &b));
+  TEST_ASSERT_FALSE(fetchSchedIsCurrent(a));
+  TEST_ASSERT_TRUE(fetchSchedIsCurrent(b));
+  fetchSchedDone(a, true, 1300);
+  TEST_ASSERT_TRUE(fetchSchedBusy());
+  fetchSchedDone(b, true, 2000);
+  TEST_ASSERT_FALSE(fetchSchedBusy());
+
+  // 방금 다 받은 격자를 들고 있으면 다시 받지 않고, 간격이 지나면 받는다.
+  TEST_ASSERT_EQUAL_INT(FETCH_RECENT, fetchSchedRequest(98, 76, true, 3000, &c));
+  TEST_ASSERT_EQUAL_INT(FETCH_START, fetchSchedRequest(98, 76, true, 2000 + FETCH_MIN_INTERVAL_MS, &c));
+  fetchSchedDone(c, false, 2000 + FETCH_MIN_INTERVAL_MS + 10);
+
+  // 실패가 있었으면 바로 다시 받는다.
+  TEST_ASSERT_EQUAL_INT(FETCH_START, fetchSchedRequest(98, 76, true, 2000 + FETCH_MIN_INTERVAL_MS + 20, &c));
+  fetchSchedDone(c, true, 10000);
+
+  // 값을 들고 있지 않으면(다른 지역을 보다가 돌아옴) 최근이어도 받는다.
+  TEST_ASSERT_EQUAL_INT(FETCH_START, fetchSchedRequest(98, 76, false, 10001, &c));
+
+  // millis()가 한 바퀴 돌아도 간격 계산이 맞아야 한다.
+  fetchSchedClear();
+  TEST_ASSERT_EQUAL_INT(FETCH_START, fetchSchedRequest(60, 127, false, 0xFFFFFF00u, &c));
+  fetchSchedDone(c, true, 0xFFFFFF00u);
+  TEST_ASSERT_EQUAL_INT(FETCH_RECENT, fetchSchedRequest(60, 127, true, 0x100u, &c));
+  fetchSchedClear();
+}
+
+static void bench_timeSeries() {
+  static TimeSeries<WeatherObs, 72> week;
+  long base = kmaHourIndex(20250101, 0);
+  WeatherObs obs = { -3.2f, 71, 0, 1.1f, 265 };
+
+  bench::run("TimeSeries<72>::put (hourly append)", 200000, [base, &obs](long i) {
+    week.put(base + i, obs);
+  });
+  long end = week.newest();
+  bench::run("TimeSeries<72>::window (12h)", 200000, [end](long) {
+    float sum = 0;
+    week.window(end, 12, [&sum](int, const WeatherObs* o) { if (o) sum += o->T1H; });
+    bench::keep(sum);
+  });
+
+  TimeSeries<WeatherObs, 24> day;
+  TEST_ASSERT_EQUAL_INT(-1, day.newest());
+  TEST_ASSERT_EQUAL_UINT32(0xFFF, day.missing(base, 12));
+
+  // 링 끝을 넘어가도록 30시간 넣으면 최근 24시간만 남는다.
+  for (int h = 0; h < 30; h++) {
+    obs.T1H = (float)h;
+    day.put(base + h, obs);
+  }
+  long now = base + 29;
+  TEST_ASSERT_EQUAL_INT(now, day.newest());
+  TEST_ASSERT_EQUAL_UINT32(0, day.missing(now, 24));
+  TEST_ASSERT_NULL(day.find(base + 5));
+  TEST_ASSERT_NOT_NULL(day.find(base + 6));
+
+  // 창은 오래된 시간부터, 링이 한 바퀴 돈 자리를 넘어도 순서대로
+  float seen[12];
+  day.window(now, 12, [&seen](int i, const WeatherObs* o) { seen[i] = o ? o->T1H : NAN; });
+  for (int i = 0; i < 12; i++) TEST_ASSERT_EQUAL_FLOAT((float)(18 + i), seen[i]);
+
+  // 미래 시간 창: 없는 시간은 nullptr
+  day.window(now + 2, 4, [&seen](int i, const WeatherObs* o) { seen[i] = o ? o->T1H : NAN; });
+  TEST_ASSERT_EQUAL_FLOAT(28.0f, seen[0]);
+  TEST_ASSERT_EQUAL_FLOAT(29.0f, seen[1]);
+  TEST_ASSERT_TRUE(isnan(seen[2]) && isnan(seen[3]));
+  TEST_ASSERT_EQUAL_UINT32(0x3, day.missing(now + 2, 4));
+
+  // 링보다 오래된 시간은 버리고, 빠진 칸은 나중에 채울 수 있다.
+  day.put(now - 24, obs);
+  TEST_ASSERT_NULL(day.find(now - 24));
+  day.put(now + 3, obs);           // now+1, now+2는 빈 채로 건너뜀
+  TEST_ASSERT_EQUAL_UINT32(0x6, day.missing(now + 3, 4));
+  obs.T1H = 100.0f;
+  day.put(now + 1, obs);
+  WeatherObs o;
+  TEST_ASSERT_TRUE(day.get(now + 1, o));
+  TEST_ASSERT_EQUAL_FLOAT(100.0f, o.T1H);
+
+  day.clear();
+  TEST_ASSERT_FALSE(day.get(now + 1, o));
+}
+
+static void bench_watchlist() {
+  watchlistClear();
+  long base = kmaHourIndex(20250101, 0);
+  WeatherObs obs = { -3.2f, 71, 0, 1.1f, 265 };
+
+  int w = watchlistAdd(60, 127);
+  bench::run("watchlistStore (hourly append)", 200000, [w, base, &obs](long i) {
+    watchlistStore(w, base + i, obs);
+  });
+  bench::run("watchlistMissing", 200000, [w, base](long i) {
+    bench::keep(watchlistMissing(w, base + (i & 1023)));
+  });
+
+  watchlistClear();
+  TEST_ASSERT_EQUAL_INT(0, watchlistAdd(60, 127));
+  TEST_ASSERT_EQUAL_INT(1, watchlistAdd(98, 76));
+  TEST_ASSERT_EQUAL_INT(0, watchlistAdd(60, 127));   // 이미 있음
+  TEST_ASSERT_EQUAL_INT(2, watchlistCount());
+  for (int i = 2; i < WATCHLIST_SIZE; i++) TEST_ASSERT_EQUAL_INT(i, watchlistAdd(10 + i, 10));
+  TEST_ASSERT_EQUAL_INT(-1, watchlistAdd(1, 1));     // 꽉 참
+
+  // 처음엔 전부 빠짐, 저장한 시간만 채워진다.
+  long now = base + 100;
+  TEST_ASSERT_EQUAL_UINT32((1u << WATCHLIST_HOURS) - 1, watchlistMissing(0, now));
+  for (int k = 0; k < WATCHLIST_HOURS; k++) {
+    obs.T1H = (float)k;
+    watchlistStore(0, now - k, obs);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, watchlistMissing(0, now));
+  TEST_ASSERT_EQUAL_UINT32((1u << WATCHLIST_HOURS) - 1, watchlistMissing(1, now));
+
+  // 한 시간 지나면 새 시간 하나만 빠지고, 그 칸은 가장 오래된 시간을 덮어쓴다.
+  TEST_ASSERT_EQUAL_UINT32(1, watchlistMissing(0, now + 1));
+  obs.T1H = -1.0f;
+  watchlistStore(0, now + 1, obs);
+  WeatherObs o;
+  TEST_ASSERT_TRUE(watchlistGet(0, now + 1, o));
+  TEST_ASSERT_EQUAL_FLOAT(-1.0f, o.T1H);
+  TEST_ASSERT_FALSE(watchlistGet(0, now - (WATCHLIST_HOURS - 1), o));
+  TEST_ASSERT_TRUE(watchlistGet(0, now - (WATCHLIST_HOURS - 2), o));
+  TEST_ASSERT_EQUAL_FLOAT((float)(WATCHLIST_HOURS - 2), o.T1H);
+
+  // 링보다 오래된 시간은 저장하지 않는다.
+  watchlistStore(0, now - WATCHLIST_HOURS - 5, obs);
+  TEST_ASSERT_TRUE(watchlistGet(0, now + 1 - WATCHLIST_HOURS + 1, o));
+
+  // 지우면 다시 빈 칸
+  TEST_ASSERT_TRUE(watchlistRemove(60, 127));
+  TEST_ASSERT_EQUAL_INT(-1, watchlistFind(60, 127));
+  TEST_ASSERT_FALSE(watchlistGet(0, now + 1, o));
+  TEST_ASSERT_EQUAL_INT(0, watchlistAdd(33, 44));
+  watchlistClear();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(bench_changeToXY);
+  RUN_TEST(bench_changeToXYFloat);
+  RUN_TEST(bench_changeToXYBatch);
+  RUN_TEST(bench_changeToLatLon);
+  RUN_TEST(bench_findNearestRegion);
+  RUN_TEST(bench_locateRegion);
+  RUN_TEST(bench_findNearestRegionScan);
+  RUN_TEST(bench_findNearestRegions);
+  RUN_TEST(bench_getLocationName);
+  RUN_TEST(bench_findXYByLocation);
+  RUN_TEST(bench_suggestLocations);
+  RUN_TEST(bench_findLocationNameByXY);
+  RUN_TEST(bench_extractWeather);
+  RUN_TEST(bench_ncstParserStream);
+  RUN_TEST(bench_extractForecastSeries);
+  RUN_TEST(bench_packObs);
+  RUN_TEST(bench_historyLog);
+  RUN_TEST(bench_historyLogMixed);
+  RUN_TEST(bench_frameDiff);
+  RUN_TEST(bench_obsCache);
+  RUN_TEST(bench_fetchSched);
+  RUN_TEST(bench_timeSeries);
+  RUN_TEST(bench_watchlist);
+  return UNITY_END();
+}
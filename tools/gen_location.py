@@ -0,0 +1,628 @@
+"""data/locations.csv 로부터 src/location.h 와 src/location_index.h 를 만든다.
+
+PlatformIO 빌드 전에 extra_scripts(pre:)로 실행되며, CSV(또는 이 스크립트)가
+바뀌었을 때만 다시 생성한다. 직접 실행해도 된다:
+
+    python tools/gen_location.py [--force] [--check] [--raster]
+
+--check 는 파일을 쓰지 않고, 커밋된 헤더가 CSV 와 맞지 않으면 실패한다.
+--raster 는 src/location_raster.h (위경도 -> 격자/지역 래스터)도 만든다. PlatformIO 에서는
+build_flags 에 -D LOCATION_RASTER 가 있을 때 자동으로 만든다. 이 파일은 커밋하지 않는다.
+
+location.h 구성
+  - locationList     : 좌표 행 (위경도 1e-6도 정수 + 격자), 12 bytes
+  - locationNameList : 이름 행 (상위 지역 + 이름 조각 + 접미사), 4 bytes
+  - locationNamePool : 두 표가 같이 쓰는 이름 조각 문자열 풀
+두 표는 같은 행 번호를 쓴다. 표가 어긋나지 않는지는 생성 단계(validate)와
+컴파일 단계(src/location_check.h 의 static_assert)에서 확인한다.
+"""
+
+import csv
+import math
+import os
+import sys
+
+# 이름 조각 끝에 자주 붙는 접미사. 번호(4 bits)로 따로 저장해서 풀을 줄인다.
+SUFFIXES = ["", "-Dong", "-Myeon", "-Gu", "-Gun", "-Si", "-do"]
+
+MAX_ROWS = 4095  # LocationName.parent 12 bits (행 번호 + 1)
+
+CSV_COLUMNS = ["grid_x", "grid_y", "lat", "lon", "name"]
+
+
+def load_locations(path):
+    """CSV 행을 (gridX, gridY, lat(1e-6도), lon(1e-6도), name) 으로 읽는다."""
+    rows = []
+    with open(path, encoding="utf-8", newline="") as f:
+        reader = csv.DictReader(f)
+        if reader.fieldnames != CSV_COLUMNS:
+            raise ValueError("%s: expected columns %s, got %s"
+                             % (path, ",".join(CSV_COLUMNS), reader.fieldnames))
+        for rec in reader:
+            rows.append((int(rec["grid_x"]), int(rec["grid_y"]),
+                         int(round(float(rec["lat"]) * 1e6)),
+                         int(round(float(rec["lon"]) * 1e6)),
+                         rec["name"]))
+    return rows
+
+
+def validate(rows):
+    """CSV 내용 검사. 잘못된 행은 ValueError, 허용하지만 알려 둘 것은 경고 목록으로."""
+    if not rows:
+        raise ValueError("no rows")
+    if len(rows) > MAX_ROWS:
+        raise ValueError("too many rows: %d (max %d)" % (len(rows), MAX_ROWS))
+
+    warnings = []
+    seen = {}
+    for i, (gx, gy, lat, lon, name) in enumerate(rows):
+        line = i + 2  # CSV 줄 번호 (헤더 다음부터)
+        if not name or name != name.strip() or "  " in name or '"' in name or "\\" in name:
+            raise ValueError("line %d: bad name %r" % (line, name))
+        if not (0 <= gx < 256 and 0 <= gy < 256):
+            raise ValueError("line %d: grid out of uint8 range (%d, %d)" % (line, gx, gy))
+        if name in seen:
+            warnings.append("line %d: duplicate name %r (line %d is used for lookups)"
+                            % (line, name, seen[name] + 2))
+        seen.setdefault(name, i)
+
+        if lat == 0 and lon == 0:
+            warnings.append("line %d: %r has no lat/lon" % (line, name))
+            continue
+        # findNearestRegion 은 3x3 격자만 보므로 격자값이 위경도와 1칸 넘게 어긋나면 안 된다.
+        px, py = lat_lon_to_grid(lat * 1e-6, lon * 1e-6)
+        if abs(px - gx) > 1 or abs(py - gy) > 1:
+            raise ValueError("line %d: %r grid (%d, %d) but lat/lon projects to (%d, %d)"
+                             % (line, name, gx, gy, px, py))
+    return warnings
+
+
+def split_suffix(part):
+    best = 0
+    for code, suffix in enumerate(SUFFIXES):
+        if suffix and part.endswith(suffix) and len(part) > len(suffix):
+            if len(suffix) > len(SUFFIXES[best]):
+                best = code
+    return part[:len(part) - len(SUFFIXES[best])], best
+
+
+def build_names(rows):
+    """행마다 (parent, stem, suffix). parent 는 상위 지역 행 번호 + 1 (0: 최상위)."""
+    first_row = {}
+    for i, row in enumerate(rows):
+        first_row.setdefault(row[4], i)
+
+    names = []
+    for i, row in enumerate(rows):
+        name = row[4]
+        if " " in name:
+            head, part = name.rsplit(" ", 1)
+            if head not in first_row:
+                raise ValueError("row %d: parent region %r not found" % (i, head))
+            parent = first_row[head] + 1
+        else:
+            part, parent = name, 0
+        stem, suffix = split_suffix(part)
+        names.append((parent, stem, suffix))
+    return names
+
+
+def build_pool(stems):
+    """이름 조각 풀. 같은 조각은 한 번만, 다른 조각의 끝부분이면 그 안을 가리킨다."""
+    offsets = {}
+    pieces = []
+    size = 0
+    for stem in sorted(set(stems), key=lambda s: (-len(s), s)):
+        if stem in offsets:
+            continue
+        pieces.append(stem)
+        for k in range(len(stem)):
+            offsets.setdefault(stem[k:], size + k)
+        offsets.setdefault("", size + len(stem))
+        size += len(stem) + 1
+    return pieces, offsets, size
+
+
+# 기상청 격자 변환 상수 (src/grid.h 와 같은 값)
+RE = 6371.00877
+GRID = 5.0
+SLAT1 = 30.0
+SLAT2 = 60.0
+OLON = 126.0
+OLAT = 38.0
+XO = 43
+YO = 136
+DEGRAD = math.pi / 180.0
+
+
+def projection_constants():
+    re_ = RE / GRID
+    slat1 = SLAT1 * DEGRAD
+    slat2 = SLAT2 * DEGRAD
+    olat = OLAT * DEGRAD
+    sn = math.tan(math.pi * 0.25 + slat2 * 0.5) / math.tan(math.pi * 0.25 + slat1 * 0.5)
+    sn = math.log(math.cos(slat1) / math.cos(slat2)) / math.log(sn)
+    sf = math.tan(math.pi * 0.25 + slat1 * 0.5)
+    sf = math.pow(sf, sn) * math.cos(slat1) / sn
+    ro = math.tan(math.pi * 0.25 + olat * 0.5)
+    ro = re_ * sf / math.pow(ro, sn)
+    return re_, sn, sf, ro
+
+
+def lat_lon_to_grid(lat, lon):
+    """src/grid.cpp changeToXY 와 같은 계산."""
+    re_, sn, sf, ro = projection_constants()
+    ra = math.tan(math.pi * 0.25 + lat * DEGRAD * 0.5)
+    ra = re_ * sf / math.pow(ra, sn)
+    theta = lon * DEGRAD - OLON * DEGRAD
+    if theta > math.pi:
+        theta -= 2.0 * math.pi
+    if theta < -math.pi:
+        theta += 2.0 * math.pi
+    theta *= sn
+    return (int(math.floor(ra * math.sin(theta) + XO + 0.5)),
+            int(math.floor(ro - ra * math.cos(theta) + YO + 0.5)))
+
+
+def grid_center(gx, gy):
+    """격자 (gx, gy) 중심의 위경도 (람베르트 정각원추도법 역변환)."""
+    re_, sn, sf, ro = projection_constants()
+    olon = OLON * DEGRAD
+
+    xn = gx - XO
+    yn = ro - gy + YO
+    ra = math.copysign(math.hypot(xn, yn), sn)
+    alat = 2.0 * math.atan(math.pow(re_ * sf / ra, 1.0 / sn)) - math.pi * 0.5
+    theta = math.atan2(xn, yn)
+    alon = theta / sn + olon
+    return alat / DEGRAD, alon / DEGRAD
+
+
+def cell_order_key(rows, i):
+    """셀 안의 대표 순서: 상위 행정구역(이름 단계가 적은 것) 먼저, 다음은 격자 중심과 가까운 순."""
+    gx, gy, lat, lon, name = rows[i]
+    clat, clon = grid_center(gx, gy)
+    dlat = lat * 1e-6 - clat
+    dlon = (lon * 1e-6 - clon) * math.cos(clat * DEGRAD)
+    return (name.count(" "), dlat * dlat + dlon * dlon, i)
+
+
+def build_grid_index(rows):
+    """(gridX, gridY) 셀별 버킷. 열(gridX)마다 셀을 gridY 순으로 정렬한다.
+
+    셀 안의 행은 cell_order_key 순서라서 첫 행이 그 격자의 대표 지역이다.
+    """
+    cells = {}
+    for i, (gx, gy, _, _, _) in enumerate(rows):
+        if not (0 <= gx < 256 and 0 <= gy < 256):
+            raise ValueError("grid out of uint8 range: row %d (%d, %d)" % (i, gx, gy))
+        cells.setdefault((gx, gy), []).append(i)
+    for members in cells.values():
+        members.sort(key=lambda i: cell_order_key(rows, i))
+
+    x_min = min(gx for gx, _ in cells)
+    x_max = max(gx for gx, _ in cells)
+
+    column_start = []
+    cell_y = []
+    cell_start = []
+    cell_rows = []
+    for gx in range(x_min, x_max + 1):
+        column_start.append(len(cell_y))
+        for gy in sorted(gy for (cx, gy) in cells if cx == gx):
+            cell_y.append(gy)
+            cell_start.append(len(cell_rows))
+            cell_rows.extend(cells[(gx, gy)])
+    column_start.append(len(cell_y))
+    cell_start.append(len(cell_rows))
+
+    return {
+        "x_min": x_min,
+        "x_max": x_max,
+        "column_start": column_start,
+        "cell_y": cell_y,
+        "cell_start": cell_start,
+        "cell_rows": cell_rows,
+    }
+
+
+RASTER_STEP = 10000           # 래스터 칸 크기 (마이크로도, 0.01°)
+
+
+def raster_candidates(cells, rows, grids, lat0, lat1, lon0, lon1):
+    """위경도 칸 안의 어느 점에서든 findNearestRegion 답이 될 수 있는 행들.
+
+    격자 g의 3x3 창 W 안에서, 칸 안 모든 점까지의 최대 거리가 가장 작은 행의 그 거리를 D라
+    하면, 칸까지의 최소 거리가 D보다 먼 행은 칸 안 어디서도 가장 가깝지 않다. 칸의 꼭짓점에
+    나오는 격자마다 이렇게 남긴 행을 합친다. 경도 축척(cos lat)은 칸 안에서 가장 불리한 값을 쓴다.
+    """
+    scale_min = math.cos(lat1 * DEGRAD)
+    scale_max = math.cos(lat0 * DEGRAD)
+    found = set()
+    for gx, gy in grids:
+        window = [i for x in (gx - 1, gx, gx + 1) for y in (gy - 1, gy, gy + 1)
+                  for i in cells.get((x, y), ())]
+        if not window:
+            continue
+        near = []
+        bound = None
+        for i in window:
+            lat = rows[i][2] * 1e-6
+            lon = rows[i][3] * 1e-6
+            dlat = max(0.0, lat0 - lat, lat - lat1)
+            dlon = max(0.0, lon0 - lon, lon - lon1) * scale_min
+            near.append((dlat * dlat + dlon * dlon, i))
+            dlat = max(abs(lat - lat0), abs(lat - lat1))
+            dlon = max(abs(lon - lon0), abs(lon - lon1)) * scale_max
+            far = dlat * dlat + dlon * dlon
+            if bound is None or far < bound:
+                bound = far
+        bound *= 1.0 + 1e-9  # 반올림 여유
+        found.update(i for d, i in near if d <= bound)
+    return tuple(sorted(found))
+
+
+def build_raster(rows):
+    """위경도 0.01° 칸 -> (격자, 후보 지역 목록) 래스터. 위도 줄마다 런 길이 부호화.
+
+    칸의 네 꼭짓점이 같은 격자면 그 격자를, 아니면 0(실행 중 changeToXY)을 넣는다.
+    (격자 칸은 래스터 칸 크기에서 볼록하므로 꼭짓점이 같으면 칸 전체가 같은 격자다.)
+    후보 목록은 raster_candidates 로, 그중 자기 격자 3x3 창 안의 가장 가까운 행이 답이다.
+    """
+    cells = {}
+    for i, (gx, gy, _, _, _) in enumerate(rows):
+        cells.setdefault((gx, gy), []).append(i)
+
+    points = [(lat, lon) for _, _, lat, lon, _ in rows if (lat, lon) != (0, 0)]
+    lat0 = min(lat for lat, _ in points) // RASTER_STEP * RASTER_STEP
+    lon0 = min(lon for _, lon in points) // RASTER_STEP * RASTER_STEP
+    lat_count = -(-(max(lat for lat, _ in points) - lat0) // RASTER_STEP)
+    lon_count = -(-(max(lon for _, lon in points) - lon0) // RASTER_STEP)
+
+    def corner_grids(i):
+        lat = (lat0 + i * RASTER_STEP) * 1e-6
+        return [lat_lon_to_grid(lat, (lon0 + j * RASTER_STEP) * 1e-6) for j in range(lon_count + 1)]
+
+    sets = {(): 0}
+    row_start = []
+    runs = []
+    below = corner_grids(0)
+    for i in range(lat_count):
+        above = corner_grids(i + 1)
+        lat_lo = (lat0 + i * RASTER_STEP) * 1e-6
+        lat_hi = (lat0 + (i + 1) * RASTER_STEP) * 1e-6
+        row_start.append(len(runs))
+        for j in range(lon_count):
+            corners = (below[j], below[j + 1], above[j], above[j + 1])
+            # 격자 번호는 칸 안에서 거의 선형이라 꼭짓점 값의 범위 안에 있다. 꼭짓점 사이로
+            # 다른 격자 칸 모서리가 지나갈 수 있으므로 범위 안의 격자를 모두 넣는다.
+            grids = {(x, y)
+                     for x in range(min(c[0] for c in corners), max(c[0] for c in corners) + 1)
+                     for y in range(min(c[1] for c in corners), max(c[1] for c in corners) + 1)}
+            cand = raster_candidates(cells, rows, grids, lat_lo, lat_hi,
+                                     (lon0 + j * RASTER_STEP) * 1e-6,
+                                     (lon0 + (j + 1) * RASTER_STEP) * 1e-6)
+            gx, gy = below[j] if len(grids) == 1 else (0, 0)
+            if len(grids) == 1 and not (0 < gx < 256 and 0 <= gy < 256):
+                raise ValueError("raster grid out of uint8 range: (%d, %d)" % (gx, gy))
+            v = (gx, gy, sets.setdefault(cand, len(sets)))
+            if len(runs) > row_start[-1] and runs[-1][1:] == v:
+                runs[-1] = (j + 1,) + v
+            else:
+                runs.append((j + 1,) + v)
+        below = above
+    row_start.append(len(runs))
+    if len(sets) > 0xFFFF:
+        raise ValueError("too many raster candidate sets: %d" % len(sets))
+
+    set_start = []
+    set_rows = []
+    for cand in sorted(sets, key=sets.get):
+        set_start.append(len(set_rows))
+        set_rows.extend(cand)
+    set_start.append(len(set_rows))
+
+    return {
+        "lat0": lat0,
+        "lon0": lon0,
+        "lat_count": lat_count,
+        "lon_count": lon_count,
+        "row_start": row_start,
+        "runs": runs,
+        "set_start": set_start,
+        "set_rows": set_rows,
+    }
+
+
+def build_name_index(rows):
+    """이름의 바이트 순서(strcmp 순서)로 정렬한 행 번호. 같은 이름은 앞 행이 먼저."""
+    return sorted(range(len(rows)), key=lambda i: rows[i][4].encode("utf-8"))
+
+
+def fold_token(token):
+    """검색용 정규화: ASCII 소문자, '-' 제거 (region.cpp foldChar 와 같은 규칙)."""
+    return token.lower().replace("-", "")
+
+
+def build_token_index(rows):
+    """마지막 이름 단계(읍면동 등)를 정규화한 순서로 정렬한 행 번호. 같으면 앞 행 먼저."""
+    return sorted(range(len(rows)),
+                  key=lambda i: fold_token(rows[i][4].rsplit(" ", 1)[-1]).encode("utf-8"))
+
+
+def c_array(ctype, name, values, per_line=16, align=None):
+    head = "alignas(%d) " % align if align else ""
+    lines = ["%sconstexpr %s %s[] PROGMEM = {" % (head, ctype, name)]
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append("    " + ", ".join(str(v) for v in chunk) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def render_location(rows, names, pool):
+    pieces, offsets, pool_size = pool
+    depth = max(name.count(" ") + 1 for *_, name in rows)
+    name_max = max(len(name) for *_, name in rows)
+
+    out = []
+    out.append("// 자동 생성 파일 - 직접 수정하지 말 것")
+    out.append("// 원본: data/locations.csv, 생성: tools/gen_location.py")
+    out.append("#ifndef LOCATION_H")
+    out.append("#define LOCATION_H")
+    out.append("")
+    out.append("#include <pgmspace.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("// 위경도 정수값 1 = 1e-6도 (37.563569 -> 37563569)")
+    out.append("#define LOCATION_COORD_UNIT 1e-6")
+    out.append("")
+    out.append("// 좌표 행 (12 bytes)")
+    out.append("struct LocationData {")
+    out.append("    int32_t lat;")
+    out.append("    int32_t lon;")
+    out.append("    uint8_t gridX;")
+    out.append("    uint8_t gridY;")
+    out.append("};")
+    out.append("")
+    out.append("// 이름 행 (4 bytes). 전체 이름 = 상위 지역 이름 + \" \" + 조각 + 접미사")
+    out.append("struct LocationName {")
+    out.append("    uint16_t parent : 12; // 상위 지역 행 번호 + 1 (0: 최상위)")
+    out.append("    uint16_t suffix : 4;  // locationNameSuffix 번호")
+    out.append("    uint16_t stem;        // locationNamePool 오프셋 (NUL 종료)")
+    out.append("};")
+    out.append("")
+    out.append("#define LOCATION_NAME_DEPTH %d  // 이름 최대 단계 (시도 / 시군구 / 읍면동)" % depth)
+    out.append("#define LOCATION_NAME_MAX %d  // 가장 긴 전체 이름 길이 (NUL 제외)" % name_max)
+    out.append("")
+    out.append("constexpr int locationCount = %d;" % len(rows))
+    out.append("")
+    out.append("// Grid Coordinates & Lat/Lon Data (English Names)")
+    out.append("constexpr LocationData locationList[] PROGMEM = {")
+    for gx, gy, lat, lon, name in rows:
+        out.append("    { %d, %d, %d, %d }, // %s" % (lat, lon, gx, gy, name))
+    out.append("};")
+    out.append("")
+    out.append("// 이름 조각 풀 (%d bytes)" % pool_size)
+    out.append("constexpr char locationNamePool[] PROGMEM =")
+    for piece in pieces:
+        out.append('    "%s\\0"' % piece)
+    out.append("    ;")
+    out.append("")
+    width = max(len(s) for s in SUFFIXES) + 1
+    out.append("constexpr char locationNameSuffix[][%d] PROGMEM = {" % width)
+    out.append("    " + ", ".join('"%s"' % s for s in SUFFIXES) + ",")
+    out.append("};")
+    out.append("")
+    out.append("// Name Search Data (English Names)")
+    out.append("constexpr LocationName locationNameList[] PROGMEM = {")
+    for (parent, stem, suffix), row in zip(names, rows):
+        out.append("    { %d, %d, %d }, // %s" % (parent, suffix, offsets[stem], row[4]))
+    out.append("};")
+    out.append("")
+    out.append("#endif // LOCATION_H")
+    out.append("")
+    return "\n".join(out)
+
+
+def render_index(rows, grid, name_order, token_order):
+    out = []
+    out.append("// 자동 생성 파일 - 직접 수정하지 말 것")
+    out.append("// 원본: data/locations.csv, 생성: tools/gen_location.py")
+    out.append("#ifndef LOCATION_INDEX_H")
+    out.append("#define LOCATION_INDEX_H")
+    out.append("")
+    out.append("#include <pgmspace.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("// =============================")
+    out.append("// 격자 버킷 인덱스 (gridX, gridY) -> locationList 행 번호")
+    out.append("// =============================")
+    out.append("// gridColumnStart[gx - GRID_INDEX_X_MIN] ~ [+1] : 해당 열의 셀 범위 (gridCellY 기준)")
+    out.append("// gridCellY[c]                             : 셀 c의 gridY (열 안에서 오름차순)")
+    out.append("// gridCellStart[c] ~ [c + 1]                : 셀 c에 속한 행 범위 (gridCellRows 기준)")
+    out.append("// 셀 안의 첫 행이 대표 지역 (상위 행정구역 우선, 다음은 격자 중심과 가까운 순)")
+    out.append("#define GRID_INDEX_X_MIN %d" % grid["x_min"])
+    out.append("#define GRID_INDEX_X_MAX %d" % grid["x_max"])
+    out.append("#define GRID_INDEX_CELL_COUNT %d" % len(grid["cell_y"]))
+    out.append("")
+    out.append(c_array("uint16_t", "gridColumnStart", grid["column_start"]))
+    out.append("")
+    out.append(c_array("uint8_t", "gridCellY", grid["cell_y"]))
+    out.append("")
+    out.append(c_array("uint16_t", "gridCellStart", grid["cell_start"]))
+    out.append("")
+    out.append(c_array("uint16_t", "gridCellRows", grid["cell_rows"]))
+    out.append("")
+    order = grid["cell_rows"]
+    out.append("#ifdef LOCATION_SOA")
+    out.append("// =============================")
+    out.append("// 좌표 열 (struct-of-arrays, gridCellRows 순서) - 호스트 빌드용")
+    out.append("// =============================")
+    out.append("// k번째 값 = locationList[gridCellRows[k]] 의 각 필드.")
+    out.append("// 격자 버킷 구간이 그대로 연속 구간이라 배치(SIMD) 거리 계산에 바로 넣을 수 있다.")
+    out.append(c_array("int32_t", "locationSoaLat", [rows[i][2] for i in order], 8, align=32))
+    out.append("")
+    out.append(c_array("int32_t", "locationSoaLon", [rows[i][3] for i in order], 8, align=32))
+    out.append("")
+    out.append(c_array("uint8_t", "locationSoaGridX", [rows[i][0] for i in order]))
+    out.append("")
+    out.append(c_array("uint8_t", "locationSoaGridY", [rows[i][1] for i in order]))
+    out.append("#endif // LOCATION_SOA")
+    out.append("")
+    out.append("// =============================")
+    out.append("// 이름 정렬 인덱스 (locationNameList 행 번호, strcmp 오름차순)")
+    out.append("// =============================")
+    out.append("// 이진 탐색으로 이름 -> 행 번호. 같은 이름이 여러 개면 앞 행이 먼저 온다.")
+    out.append(c_array("uint16_t", "locationNameOrder", name_order))
+    out.append("")
+    out.append("// =============================")
+    out.append("// 단어 인덱스 (마지막 이름 단계를 소문자·'-' 제거로 정렬한 행 번호)")
+    out.append("// =============================")
+    out.append("// \"samyang\" -> \"... Samyang-Dong\" 처럼 단어 앞부분으로 찾을 때 이진 탐색한다.")
+    out.append(c_array("uint16_t", "locationTokenOrder", token_order))
+    out.append("")
+    out.append("#endif // LOCATION_INDEX_H")
+    out.append("")
+    return "\n".join(out)
+
+
+def render_raster(raster):
+    runs = raster["runs"]
+    out = []
+    out.append("// 자동 생성 파일 - 직접 수정하지 말 것 (LOCATION_RASTER 빌드에서만 생성)")
+    out.append("// 원본: data/locations.csv, 생성: tools/gen_location.py")
+    out.append("#ifndef LOCATION_RASTER_H")
+    out.append("#define LOCATION_RASTER_H")
+    out.append("")
+    out.append("#include <pgmspace.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("// =============================")
+    out.append("// 위경도 래스터 (0.01° 칸 -> 격자, 가장 가까운 지역 후보)")
+    out.append("// =============================")
+    out.append("// 위도 줄 i = (lat - LAT0) / STEP, 경도 칸 j = (lon - LON0) / STEP (마이크로도).")
+    out.append("// 줄 i의 런은 locationRasterRuns[locationRasterRowStart[i] ~ [i + 1]] 이고,")
+    out.append("// 각 런은 경도 칸 [앞 런의 end, end) 를 덮는다.")
+    out.append("// gridX == 0 : 칸 안에 격자 경계가 지나감 -> changeToXY로 격자를 구한다.")
+    out.append("// set        : 후보 행 locationRasterSetRows[locationRasterSetStart[set] ~ [set + 1]].")
+    out.append("//              그중 격자 3x3 창 안에서 가장 가까운 행이 findNearestRegion 답이다.")
+    out.append("#define LOCATION_RASTER_STEP %d" % RASTER_STEP)
+    out.append("#define LOCATION_RASTER_LAT0 %d" % raster["lat0"])
+    out.append("#define LOCATION_RASTER_LON0 %d" % raster["lon0"])
+    out.append("#define LOCATION_RASTER_LAT_COUNT %d" % raster["lat_count"])
+    out.append("#define LOCATION_RASTER_LON_COUNT %d" % raster["lon_count"])
+    out.append("#define LOCATION_RASTER_SET_COUNT %d" % (len(raster["set_start"]) - 1))
+    out.append("")
+    out.append("struct LocationRasterRun {")
+    out.append("    uint16_t end;   // 이 런이 끝나는 경도 칸 (다음 칸 번호)")
+    out.append("    uint8_t gridX;  // 0이면 격자 경계 칸")
+    out.append("    uint8_t gridY;")
+    out.append("    uint16_t set;   // 후보 목록 번호")
+    out.append("};")
+    out.append("")
+    out.append(c_array("uint32_t", "locationRasterRowStart", raster["row_start"], 8))
+    out.append("")
+    out.append("constexpr LocationRasterRun locationRasterRuns[] PROGMEM = {")
+    for k in range(0, len(runs), 4):
+        out.append("    " + " ".join("{%d, %d, %d, %d}," % r for r in runs[k:k + 4]))
+    out.append("};")
+    out.append("")
+    out.append(c_array("uint32_t", "locationRasterSetStart", raster["set_start"], 8))
+    out.append("")
+    out.append(c_array("uint16_t", "locationRasterSetRows", raster["set_rows"]))
+    out.append("")
+    out.append("#endif // LOCATION_RASTER_H")
+    out.append("")
+    return "\n".join(out)
+
+
+def render_all(src):
+    rows = load_locations(src)
+    warnings = validate(rows)
+    names = build_names(rows)
+    pool = build_pool(stem for _, stem, _ in names)
+    if pool[2] > 0xFFFF:
+        raise ValueError("name pool too large: %d bytes" % pool[2])
+
+    texts = [render_location(rows, names, pool),
+             render_index(rows, build_grid_index(rows), build_name_index(rows),
+                          build_token_index(rows))]
+    return rows, pool[2], warnings, texts
+
+
+def output_paths(project_dir):
+    return [os.path.join(project_dir, "src", "location.h"),
+            os.path.join(project_dir, "src", "location_index.h")]
+
+
+def raster_path(project_dir):
+    return os.path.join(project_dir, "src", "location_raster.h")
+
+
+def is_stale(paths, newest_input):
+    return not all(os.path.exists(p) and os.path.getmtime(p) >= newest_input for p in paths)
+
+
+def generate(project_dir, force=False, raster=False):
+    src = os.path.join(project_dir, "data", "locations.csv")
+    outputs = output_paths(project_dir)
+    newest_input = max(os.path.getmtime(src), os.path.getmtime(__file__))
+
+    if force or is_stale(outputs, newest_input):
+        rows, pool_size, warnings, texts = render_all(src)
+        for w in warnings:
+            print("gen_location: warning: %s" % w)
+        for path, text in zip(outputs, texts):
+            with open(path, "w", encoding="utf-8", newline="\n") as f:
+                f.write(text)
+        print("gen_location: %d rows, name pool %d bytes -> src/location.h, src/location_index.h"
+              % (len(rows), pool_size))
+
+    # 래스터는 LOCATION_RASTER 빌드(호스트)에서만 쓰므로 그때만 만들고 커밋하지 않는다.
+    if raster and (force or is_stale([raster_path(project_dir)], newest_input)):
+        table = build_raster(load_locations(src))
+        with open(raster_path(project_dir), "w", encoding="utf-8", newline="\n") as f:
+            f.write(render_raster(table))
+        print("gen_location: raster %dx%d, %d runs -> src/location_raster.h"
+              % (table["lat_count"], table["lon_count"], len(table["runs"])))
+
+
+def build_flags_define(env, name):
+    """PlatformIO 환경의 build_flags 에 -D name 이 있는지."""
+    flags = env.GetProjectOption("build_flags", "")
+    if not isinstance(flags, str):
+        flags = " ".join(flags)
+    words = flags.split()
+    return any(w in ("-D" + name, "-D%s=1" % name) for w in words) or \
+        any(a == "-D" and b.split("=")[0] == name for a, b in zip(words, words[1:]))
+
+
+def check(project_dir):
+    """커밋된 헤더가 지금 CSV 로 만든 결과와 같은지 확인한다."""
+    src = os.path.join(project_dir, "data", "locations.csv")
+    _, _, _, texts = render_all(src)
+    stale = []
+    for path, text in zip(output_paths(project_dir), texts):
+        if not os.path.exists(path):
+            stale.append(path)
+            continue
+        with open(path, encoding="utf-8", newline="") as f:
+            if f.read() != text:
+                stale.append(path)
+    for path in stale:
+        print("gen_location: %s is out of date with data/locations.csv"
+              % os.path.relpath(path, project_dir))
+    return not stale
+
+
+try:
+    Import("env")  # noqa: F821  (PlatformIO extra_scripts)
+    generate(env.subst("$PROJECT_DIR"),  # noqa: F821
+             raster=build_flags_define(env, "LOCATION_RASTER"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+        if "--check" in sys.argv:
+            sys.exit(0 if check(root) else 1)
+        generate(root, force="--force" in sys.argv, raster="--raster" in sys.argv)